@@ -1,12 +1,18 @@
+#ifdef _WIN32
+    #include <windows.h>
+#endif
 #include <GL/glut.h>
 #include <iostream>
-#include <vector>
 #include <cstdlib>
-#include <ctime>
+#include <cstring>
+#include <cstdint>
 #include <chrono>
+#include <random>
+#include <vector>
 
-#include "src/player/Player.h"
-#include "src/obstacle/Obstacle.h"
+#include "src/world/World.h"
+#include "src/replay/Replay.h"
+#include "src/replay/RewindBuffer.h"
 #include "src/scene/Scene.h"
 #include "src/collision/Collision.h"
 #include "src/score/Score.h"
@@ -14,199 +20,112 @@
 #include "src/texture/Texture.h"
 #include "src/lighting/Lighting.h"
 #include "src/audio/Audio.h"
+#include "src/events/EventBus.h"
+#include "src/events/Telemetry.h"
+#include "src/viewport/Viewport.h"
+#include "src/timing/FixedTimestep.h"
+#include "src/timing/PerfCounter.h"
+#include "src/timing/LatencyStats.h"
+#include "src/timing/FramePacer.h"
+#include "src/input/InputQueue.h"
 
 // Variáveis globais do jogo
-Player* player;
+World* world;   // Simulação (jogador, obstáculos, pontuação)
 Scene* scene;
-Score* score;
 Menu* menu;
 Audio* audio;
-std::vector<Obstacle> obstacles;
 
-// Controle de tempo
-std::chrono::high_resolution_clock::time_point lastTime;
-float deltaTime = 0.0f;
+// Controle de tempo: simulação em passo fixo (120 Hz) e renderização interpolada
+std::chrono::steady_clock::time_point lastTime;
+FixedTimestep timestep;
+float renderAlpha = 1.0f;
+
+// Ritmo dos quadros (--vsync, --fps N ou --uncapped; padrão 60 Hz)
+FramePacer framePacer;
+PacingMode pacingMode = PACING_FIXED;
+int targetFps = 60;
+
+// Medição separada do custo da simulação e da renderização
+PerfCounter tickCost("Tick");
+PerfCounter renderCost("Render");
+float perfReportTimer = 0.0f;
 
-// Configurações da janela
+// Entradas do teclado com timestamp, aplicadas no tick a que pertencem, e a
+// latência da chegada até o tick que as aplicou e até o swap que as mostrou
+InputQueue inputQueue;
+std::vector<std::chrono::steady_clock::time_point> inputsAwaitingSwap;
+LatencyStats inputToTick("Entrada -> tick");
+LatencyStats inputToSwap("Entrada -> swap");
+
+// Configurações da janela (tamanho inicial em pontos; o viewport real vem do reshape)
 const int WINDOW_WIDTH = 800;
 const int WINDOW_HEIGHT = 600;
 
 // Controle do jogo
 GameState gameState = MENU;
 bool debugMode = false;
-float obstacleSpawnTimer = 0.0f;
-float OBSTACLE_SPAWN_INTERVAL = 2.0f;
 
-// Sistema de velocidade progressiva
-float gameTime = 0.0f;
-float speedMultiplier = 1.0f;
-const float SPEED_INCREASE_INTERVAL = 20.0f; // A cada 20 segundos
-const float SPEED_INCREASE_AMOUNT = 0.5f; // Aumenta 0.5x
+// Seed da sessão: todas as partidas e texturas derivam dela (--seed N)
+uint64_t sessionSeed = 0;
+bool sessionSeedSet = false;
+uint64_t runCount = 0;
+
+// Cache em disco das texturas procedurais. Sem seed fixa as texturas mudam a
+// cada execução, então por padrão ele só é usado com --seed
+std::string textureCacheDir = "texture_cache";
+bool textureCacheRequested = false;  // --texture-cache diretório
+bool textureCacheDisabled = false;   // --no-texture-cache
+float maxAnisotropy = 16.0f;         // --anisotropy N (1 desliga)
+
+// Gravação (--record arquivo) e reprodução (--replay arquivo) de partidas
+ReplayRecorder recorder;
+std::string recordFile;
+ReplayPlayer replayPlayer;
+bool replayMode = false;
+
+// Snapshots: início da partida atual ('T' repete a mesma fase) e pausa em disco
+WorldSnapshot runStart;
+bool runStartValid = false;
+const char* SAVE_FILE = "savegame.cds";
+std::string loadStateFile;     // --load-state arquivo: continua uma partida salva
+
+// Rewind: últimos segundos da partida, para voltar depois de uma colisão
+RewindBuffer rewindBuffer;
+long long rewindTick = 0;
+const int REWIND_STEP_TICKS = 30;  // 0,25 s por toque nas setas
+
+// Eventos da partida: o jogo publica as transições e cada assinante (áudio,
+// HUD/pontuação, telemetria) esvazia sua fila no seu ritmo
+EventBus events;
+EventBus::Queue* hudEvents = NULL;
+Telemetry telemetry;
+std::string telemetryFile;     // --telemetry arquivo: CSV com todos os eventos
+
+// Faixa de "nível de velocidade" no HUD
+int speedBannerLevel = 0;
+float speedBannerTimer = 0.0f;
+const float SPEED_BANNER_TIME = 2.0f;
 
 // Sistema de câmera
 bool firstPersonView = false;
 
 // Declarações de funções
-void spawnObstacle();
-void spawnSingleObstacle();
-void spawnTwoObstacles();
 void setupFirstPersonCamera();
-
-// Função para spawnar obstáculos
-void spawnObstacle() {
-    // Decidir se vai spawnar 1 ou 2 obstáculos (30% de chance para 2 obstáculos)
-    bool spawnTwo = (rand() % 100) < 30;
-    
-    if (spawnTwo) {
-        // Spawnar 2 obstáculos em faixas diferentes
-        spawnTwoObstacles();
-    } else {
-        // Spawnar 1 obstáculo (comportamento original)
-        spawnSingleObstacle();
-    }
-}
-
-// Função para spawnar um único obstáculo
-void spawnSingleObstacle() {
-    // Escolher faixa aleatória (0, 1, 2)
-    int lane = rand() % 3;
-    float x = (lane - 1) * 3.0f; // Converter para posição X
-    
-    // Escolher tipo de obstáculo (agora com 3 tipos)
-    int obstacleChoice = rand() % 3;
-    ObstacleType type;
-    Vector3 size;
-    
-    if (obstacleChoice == 0) {
-        type = STATIC;
-        size = Vector3(1.0f, 2.0f, 1.0f);
-    } else if (obstacleChoice == 1) {
-        type = MOVING_VERTICAL;
-        size = Vector3(1.0f, 2.0f, 1.0f);
-    } else if (obstacleChoice == 2) {
-        type = ROCKET;
-        size = Vector3(1.2f, 4.0f, 3.0f); // Foguete muito alto - impossível de pular
-    } else {
-        type = HIGH_OBSTACLE;
-        size = Vector3(1.0f, 2.5f, 1.0f); // Obstáculo alto - elevado do chão
-    }
-    
-    // Posição inicial (muito mais à frente do jogador)
-    Vector3 position(x, 2.0f, -50.0f);
-    
-    // Ajustar posição Y para obstáculos altos (elevados do chão)
-    if (type == HIGH_OBSTACLE) {
-        position.y = 3.0f; // Elevado do chão para permitir deslize embaixo
-    }
-    
-    // Encontrar um obstáculo inativo para reutilizar
-    bool spawned = false;
-    for (auto& obstacle : obstacles) {
-        if (!obstacle.isActive()) {
-            obstacle.reset(position, size, type);
-            spawned = true;
-            break;
-        }
-    }
-    
-    // Se não encontrou um inativo, criar novo (limite reduzido para performance)
-    if (!spawned && obstacles.size() < 15) {
-        obstacles.push_back(Obstacle(position, size, type));
-    }
-}
-
-// Função para spawnar dois obstáculos em faixas diferentes
-void spawnTwoObstacles() {
-    // Escolher duas faixas diferentes
-    int lane1 = rand() % 3;
-    int lane2;
-    do {
-        lane2 = rand() % 3;
-    } while (lane2 == lane1); // Garantir que são faixas diferentes
-    
-    float x1 = (lane1 - 1) * 3.0f;
-    float x2 = (lane2 - 1) * 3.0f;
-    
-    // Escolher tipos de obstáculos (evitar dois obstáculos impossíveis simultaneamente)
-    int choice1 = rand() % 4;
-    int choice2 = rand() % 4;
-    
-    // Se ambos forem impossíveis de pular (ROCKET ou HIGH_OBSTACLE), mudar um deles
-    if ((choice1 == 2 || choice1 == 3) && (choice2 == 2 || choice2 == 3)) {
-        choice2 = rand() % 2; // Apenas STATIC ou MOVING_VERTICAL
-    }
-    
-    // Criar primeiro obstáculo
-    ObstacleType type1;
-    Vector3 size1;
-    
-    if (choice1 == 0) {
-        type1 = STATIC;
-        size1 = Vector3(1.0f, 2.0f, 1.0f);
-    } else if (choice1 == 1) {
-        type1 = MOVING_VERTICAL;
-        size1 = Vector3(1.0f, 2.0f, 1.0f);
-    } else if (choice1 == 2) {
-        type1 = ROCKET;
-        size1 = Vector3(1.2f, 4.0f, 3.0f);
-    } else {
-        type1 = HIGH_OBSTACLE;
-        size1 = Vector3(1.0f, 2.5f, 1.0f);
-    }
-    
-    // Criar segundo obstáculo
-    ObstacleType type2;
-    Vector3 size2;
-    
-    if (choice2 == 0) {
-        type2 = STATIC;
-        size2 = Vector3(1.0f, 2.0f, 1.0f);
-    } else if (choice2 == 1) {
-        type2 = MOVING_VERTICAL;
-        size2 = Vector3(1.0f, 2.0f, 1.0f);
-    } else if (choice2 == 2) {
-        type2 = ROCKET;
-        size2 = Vector3(1.2f, 4.0f, 3.0f);
-    } else {
-        type2 = HIGH_OBSTACLE;
-        size2 = Vector3(1.0f, 2.5f, 1.0f);
-    }
-    
-    // Posições iniciais (muito mais à frente do jogador)
-    Vector3 position1(x1, 2.0f, -50.0f);
-    Vector3 position2(x2, 2.0f, -50.0f);
-    
-    // Ajustar posição Y para obstáculos altos (elevados do chão)
-    if (type1 == HIGH_OBSTACLE) {
-        position1.y = 3.0f;
-    }
-    if (type2 == HIGH_OBSTACLE) {
-        position2.y = 3.0f;
-    }
-    
-    // Encontrar obstáculos inativos para reutilizar
-    int spawned = 0;
-    for (auto& obstacle : obstacles) {
-        if (!obstacle.isActive() && spawned < 2) {
-            if (spawned == 0) {
-                obstacle.reset(position1, size1, type1);
-            } else {
-                obstacle.reset(position2, size2, type2);
-            }
-            spawned++;
-        }
-    }
-    
-    // Se não encontrou inativos suficientes, criar novos (limite reduzido para performance)
-    while (spawned < 2 && obstacles.size() < 15) {
-        if (spawned == 0) {
-            obstacles.push_back(Obstacle(position1, size1, type1));
-        } else {
-            obstacles.push_back(Obstacle(position2, size2, type2));
-        }
-        spawned++;
-    }
-}
+void simulationTick(float deltaTime);
+void reportPerformance();
+void startGame();
+void retryRun();
+bool resumeSavedGame(const std::string& filename);
+void saveGameToDisk();
+void beginPlaying();
+void startRewind();
+void seekRewind(long long tick);
+void renderWorld(float alpha);
+bool parseArguments(int argc, char** argv);
+void queuePlayerInput(InputAction action);
+void applyPlayerInput(InputAction action);
+void finishRecording();
+void processHudEvents(float frameTime);
 
 // Função de inicialização
 void init() {
@@ -215,14 +134,24 @@ void init() {
     glEnable(GL_CULL_FACE);
     glCullFace(GL_BACK);
     
+    // Sem --seed, sortear uma seed nova para a sessão
+    if (!sessionSeedSet) {
+        std::random_device device;
+        sessionSeed = ((uint64_t)device() << 32) | device();
+    }
+    std::cout << "Seed da sessão: " << sessionSeed << " (reproduza com --seed " << sessionSeed << ")" << std::endl;
+    
     // Inicializar sistemas
-    Texture::init();
+    if (!textureCacheDisabled && (sessionSeedSet || textureCacheRequested)) {
+        Texture::setCacheDirectory(textureCacheDir);
+    }
+    Texture::setMaxAnisotropy(maxAnisotropy);
+    Texture::init(Random::deriveSeed(sessionSeed, STREAM_TEXTURES));
     Lighting::initGameLighting();  // Usar a nova função de iluminação específica do jogo
     
     // Criar objetos do jogo
-    player = new Player();
+    world = new World();
     scene = new Scene();
-    score = new Score();
     menu = new Menu();
     audio = new Audio();
     
@@ -234,106 +163,291 @@ void init() {
         audio->playMenuMusic();
     }
     
+    // Assinantes do barramento de eventos (antes da primeira publicação)
+    audio->startEventThread(events);
+    hudEvents = events.subscribe("hud");
+    telemetry.start(events, telemetryFile);
+    
     // Inicializar cena
     scene->init();
     
     // Configurar tempo inicial
-    lastTime = std::chrono::high_resolution_clock::now();
-    
-    // Inicializar gerador de números aleatórios
-    srand(time(NULL));
+    lastTime = std::chrono::steady_clock::now();
     
     std::cout << "Cosmic Dash inicializado com sucesso!" << std::endl;
 }
 
-// Função de atualização
+// Função de atualização (chamada uma vez por quadro)
 void update() {
-    // Calcular delta time
-    auto currentTime = std::chrono::high_resolution_clock::now();
-    deltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
+    // Tempo real decorrido desde o último quadro
+    auto currentTime = std::chrono::steady_clock::now();
+    float frameTime = std::chrono::duration<float>(currentTime - lastTime).count();
     lastTime = currentTime;
     
-    // Limitar delta time para evitar grandes saltos
-    if (deltaTime > 0.1f) deltaTime = 0.1f;
-    
     // Atualizar sistema de áudio
     if (audio) {
         audio->update();
     }
     
-    // Atualizar tempo de jogo e velocidade (para todos os estados)
-    if (gameState == PLAYING) {
-        gameTime += deltaTime;
-        
-        // Aumentar velocidade a cada 20 segundos
-        int currentSpeedLevel = (int)(gameTime / SPEED_INCREASE_INTERVAL);
-        speedMultiplier = 1.0f + (currentSpeedLevel * SPEED_INCREASE_AMOUNT);
+    // Transições publicadas desde o último quadro (teclado e ticks)
+    processHudEvents(frameTime);
+    
+    // Relatório periódico de desempenho no modo debug
+    perfReportTimer += frameTime;
+    if (debugMode && perfReportTimer >= 2.0f) {
+        reportPerformance();
+    }
+    
+    if (gameState != PLAYING) {
+        // Fora do jogo a simulação fica parada; não acumular tempo
+        timestep.reset();
+        inputQueue.clear();
+        renderAlpha = 1.0f;
+        return;
+    }
+    
+    // Executar quantos ticks fixos couberem no tempo do quadro. A simulação
+    // está atrás do relógio pelo resto do acumulador; daí sai o instante
+    // real em que cada um desses ticks começa
+    int ticks = timestep.advance(frameTime);
+    std::chrono::duration<float> step(timestep.getStepSize());
+    auto simulationNow = currentTime - std::chrono::duration_cast<std::chrono::steady_clock::duration>(step * timestep.getAlpha());
+    for (int i = 0; i < ticks && gameState == PLAYING; i++) {
+        auto tickStart = simulationNow - std::chrono::duration_cast<std::chrono::steady_clock::duration>(step * (float)(ticks - i));
         
-        // Atualizar velocidade da cena
-        scene->setFloorSpeed(20.0f * speedMultiplier);
+        // Entradas que chegaram antes do início deste tick; as mais novas
+        // ficam na fila para um tick posterior
+        TimedInput input;
+        while (inputQueue.popUntil(tickStart, input)) {
+            applyPlayerInput(input.action);
+            inputToTick.add(std::chrono::duration<double>(std::chrono::steady_clock::now() - input.arrival).count());
+            inputsAwaitingSwap.push_back(input.arrival);
+        }
         
-        // Ajustar intervalo de spawn baseado na velocidade (mais rápido = menos obstáculos por segundo)
-        OBSTACLE_SPAWN_INTERVAL = 2.0f + (speedMultiplier - 1.0f) * 0.3f;
+        tickCost.begin();
+        simulationTick(timestep.getStepSize());
+        tickCost.end();
     }
     
-    switch (gameState) {
-        case PLAYING:
-            // Atualizar jogador
-            player->update(deltaTime);
-            
-            // Atualizar cena
-            scene->update(deltaTime);
-            
-            // Atualizar pontuação
-            score->update(deltaTime);
-            
-            // Spawnar obstáculos
-            obstacleSpawnTimer += deltaTime;
-            if (obstacleSpawnTimer >= OBSTACLE_SPAWN_INTERVAL) {
-                spawnObstacle();
-                obstacleSpawnTimer = 0.0f;
-            }
-            
-            // Atualizar obstáculos
-            for (auto& obstacle : obstacles) {
-                if (obstacle.isActive()) {
-                    obstacle.update(deltaTime);
-                    obstacle.moveZ(scene->getFloorSpeed() * deltaTime);
-                    
-                    // Desativar obstáculos que saíram da tela
-                    if (obstacle.getPosition().z > 20.0f) {
-                        obstacle.setActive(false);
-                    }
-                }
-            }
-            
-            // Verificar colisões
-            if (Collision::checkCollisionWithObstacles(*player, obstacles)) {
-                gameState = GAME_OVER;
-                score->gameOver();
+    // Fração do próximo tick para interpolar a renderização
+    renderAlpha = (gameState == PLAYING) ? timestep.getAlpha() : 1.0f;
+}
+
+// Um tick de simulação com passo fixo
+void simulationTick(float deltaTime) {
+    // A cena (chão animado) acompanha a velocidade da simulação
+    scene->storePreviousState();
+    
+    // No modo replay as entradas vêm do arquivo, no tick exato em que foram gravadas
+    if (replayMode) {
+        replayPlayer.applyInputs(*world);
+    }
+    
+    int speedLevel = world->getSpeedLevel();
+    bool collided = world->tick(deltaTime);
+    
+    if (replayMode) {
+        if (!replayPlayer.verifyTick(*world) && replayPlayer.getDivergenceTick() == world->getTickCount()) {
+            std::cerr << "Replay divergiu no tick " << world->getTickCount() << "!" << std::endl;
+        }
+        if (replayPlayer.isFinished(*world) && !collided) {
+            std::cout << "Replay concluído no tick " << world->getTickCount() << std::endl;
+            collided = true;
+        }
+    } else {
+        recorder.recordTick(*world);
+        rewindBuffer.record(*world);
+    }
+    
+    scene->setFloorSpeed(world->getFloorSpeed());
+    scene->update(deltaTime);
+    
+    if (collided) {
+        gameState = GAME_OVER;
+        events.publish(EVENT_COLLIDED, *world);
+        finishRecording();
+    } else if (world->getSpeedLevel() > speedLevel) {
+        events.publish(EVENT_SPEED_LEVEL_UP, *world);
+    }
+}
+
+// Assinante de HUD e pontuação: esvaziado uma vez por quadro na thread do jogo
+void processHudEvents(float frameTime) {
+    if (speedBannerTimer > 0.0f) {
+        speedBannerTimer -= frameTime;
+    }
+    
+    GameEvent event;
+    while (hudEvents && hudEvents->pop(event)) {
+        switch (event.type) {
+            case EVENT_COLLIDED:
                 menu->setState(GAME_OVER);
-            }
-            
-            break;
-            
-        case MENU:
-        case GAME_OVER:
-        case PAUSED:
-            // Estados de menu não precisam de atualização de jogo
-            break;
+                speedBannerTimer = 0.0f;
+                std::cout << "Fim de partida: " << event.score << " pontos em " << event.gameTime << "s";
+                if (event.score > 0 && event.score >= event.highScore) {
+                    std::cout << " (novo recorde!)";
+                }
+                std::cout << std::endl;
+                break;
+            case EVENT_PAUSED:
+                menu->setState(PAUSED);
+                break;
+            case EVENT_MENU_OPENED:
+                menu->setState(MENU);
+                break;
+            case EVENT_SPEED_LEVEL_UP:
+                speedBannerLevel = event.speedLevel;
+                speedBannerTimer = SPEED_BANNER_TIME;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+// Enfileira um comando do teclado com o instante de chegada
+void queuePlayerInput(InputAction action) {
+    // Durante a reprodução o teclado não controla o jogador
+    if (replayMode) return;
+    
+    inputQueue.push(action);
+}
+
+// Aplica um comando do jogador à simulação e grava no replay
+void applyPlayerInput(InputAction action) {
+    // Durante a reprodução o teclado não controla o jogador
+    if (replayMode) return;
+    
+    world->applyInput(action);
+    recorder.recordInput(*world, action);
+}
+
+// Salva a partida gravada (se houver)
+void finishRecording() {
+    if (!recorder.isRecording()) return;
+    recorder.stop();
+    if (recorder.save(recordFile)) {
+        std::cout << "Replay salvo em " << recordFile << " (" << recorder.getData().checksums.size()
+                  << " ticks, " << recorder.getData().events.size() << " entradas)" << std::endl;
+    }
+}
+
+// Inicia (ou reinicia) uma partida
+void startGame() {
+    if (replayMode) {
+        // Reproduzir a partida gravada (mesma seed e parâmetros)
+        if (!replayPlayer.start(*world)) {
+            std::cout << "Snapshot inicial do replay inválido; reproduzindo a partir da seed" << std::endl;
+        }
+        std::cout << "Reproduzindo replay - seed " << world->getSeed() << ", "
+                  << replayPlayer.getTotalTicks() << " ticks" << std::endl;
+    } else {
+        // Cada partida tem sua própria seed, derivada da seed da sessão
+        uint64_t runSeed = Random::deriveSeed(sessionSeed, ++runCount);
+        world->reset(runSeed);
+        std::cout << "Partida " << runCount << " - seed " << runSeed << std::endl;
+        runStartValid = world->saveSnapshot(runStart);
+        
+        if (!recordFile.empty()) {
+            recorder.begin(*world, FixedTimestep::DEFAULT_RATE);
+        }
     }
+    beginPlaying();
+}
+
+// Repete a partida atual desde o início (mesma seed), restaurando o snapshot
+void retryRun() {
+    if (replayMode || !runStartValid) {
+        startGame();
+        return;
+    }
+    world->loadSnapshot(runStart);
+    std::cout << "Repetindo a partida - seed " << world->getSeed() << std::endl;
+    if (!recordFile.empty()) {
+        recorder.begin(*world, FixedTimestep::DEFAULT_RATE);
+    }
+    beginPlaying();
+}
+
+// Continua uma partida salva em disco (não é gravada em replay: o replay
+// precisa da partida desde o início)
+bool resumeSavedGame(const std::string& filename) {
+    WorldSnapshot snapshot;
+    if (!snapshot.loadFromFile(filename) || !world->loadSnapshot(snapshot)) {
+        std::cerr << "Não foi possível continuar a partida de " << filename << std::endl;
+        return false;
+    }
+    runStartValid = false;
+    std::cout << "Partida continuada de " << filename << " - seed " << world->getSeed()
+              << ", " << world->getGameTime() << "s de jogo" << std::endl;
+    beginPlaying();
+    return true;
+}
+
+// Salva a partida pausada em disco
+void saveGameToDisk() {
+    WorldSnapshot snapshot;
+    if (world->saveSnapshot(snapshot) && snapshot.saveToFile(SAVE_FILE)) {
+        std::cout << "Partida salva em " << SAVE_FILE << " (continue com --load-state "
+                  << SAVE_FILE << ")" << std::endl;
+    }
+}
+
+// Passa para o estado de jogo e troca a música
+void beginPlaying() {
+    gameState = PLAYING;
+    timestep.reset();
+    rewindBuffer.clear();
+    inputQueue.clear();
+    speedBannerTimer = 0.0f;
+    events.publish(EVENT_GAME_STARTED, *world);
+}
+
+// Entra no modo rewind a partir da colisão (não existe durante replays)
+void startRewind() {
+    if (replayMode || rewindBuffer.isEmpty()) return;
+    gameState = REWINDING;
+    seekRewind(rewindBuffer.getNewestTick() - REWIND_STEP_TICKS);
+}
+
+// Mostra o estado de um tick da janela de rewind
+void seekRewind(long long tick) {
+    if (tick < rewindBuffer.getOldestTick()) tick = rewindBuffer.getOldestTick();
+    if (tick > rewindBuffer.getNewestTick()) tick = rewindBuffer.getNewestTick();
+    rewindTick = tick;
+    rewindBuffer.seek(*world, rewindTick);
+    scene->setFloorSpeed(world->getFloorSpeed());
+}
+
+// Renderiza cena, jogador e obstáculos
+void renderWorld(float alpha) {
+    scene->render(alpha);
+    world->getPlayer().render(alpha);
+    world->getObstacles().render(alpha);
+}
+
+// Imprime o custo médio dos ticks e da renderização e reinicia os contadores
+void reportPerformance() {
+    std::cout << "=== Desempenho (últimos " << perfReportTimer << "s) ===" << std::endl;
+    tickCost.print();
+    renderCost.print();
+    inputToTick.print();
+    inputToSwap.print();
+    tickCost.reset();
+    renderCost.reset();
+    inputToTick.reset();
+    inputToSwap.reset();
+    perfReportTimer = 0.0f;
 }
 
 // Função de renderização
 void display() {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    renderCost.begin();
     
-    // Configurar projeção 3D
-    glMatrixMode(GL_PROJECTION);
-    glLoadIdentity();
-    gluPerspective(60.0, (double)WINDOW_WIDTH / WINDOW_HEIGHT, 1.0, 1000.0);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     
-    glMatrixMode(GL_MODELVIEW);
+    // Configurar projeção 3D (matriz em cache, recalculada só no reshape)
+    Viewport::apply3D();
     glLoadIdentity();
     
     switch (gameState) {
@@ -345,27 +459,23 @@ void display() {
                 scene->setupCamera();
             }
             
-            // Renderizar cena
-            scene->render();
-            
-            // Renderizar jogador
-            player->render();
-            
-            // Renderizar obstáculos
-            for (const auto& obstacle : obstacles) {
-                obstacle.render();
-            }
+            // Renderizar cena, jogador e obstáculos (interpolados entre os dois últimos ticks)
+            renderWorld(renderAlpha);
             
             // Debug: renderizar bounding boxes
             if (debugMode) {
-                Collision::renderPlayerBoundingBox(*player);
-                for (const auto& obstacle : obstacles) {
-                    Collision::renderObstacleBoundingBox(obstacle);
+                Collision::renderPlayerBoundingBox(world->getPlayer());
+                const ObstacleSystem& obstacles = world->getObstacles();
+                for (int i = 0; i < obstacles.size(); i++) {
+                    Collision::renderObstacleBoundingBox(obstacles.get(i));
                 }
             }
             
             // Renderizar HUD
-            score->render();
+            world->getScore().render();
+            if (speedBannerTimer > 0.0f) {
+                menu->renderSpeedBanner(speedBannerLevel, speedBannerTimer / SPEED_BANNER_TIME);
+            }
             break;
             
         case MENU:
@@ -375,42 +485,54 @@ void display() {
         case GAME_OVER:
             // Renderizar cena em segundo plano (sem atualização)
             scene->setupCamera();
-            scene->render();
-            player->render();
-            for (const auto& obstacle : obstacles) {
-                obstacle.render();
-            }
+            renderWorld(1.0f);
             
             // Renderizar tela de game over
-            score->renderGameOverScreen();
+            world->getScore().renderGameOverScreen();
             break;
             
         case PAUSED:
             // Renderizar cena pausada
             scene->setupCamera();
-            scene->render();
-            player->render();
-            for (const auto& obstacle : obstacles) {
-                obstacle.render();
-            }
+            renderWorld(1.0f);
             
             // Renderizar menu de pausa
             menu->render();
             break;
+            
+        case REWINDING: {
+            scene->setupCamera();
+            renderWorld(1.0f);
+            world->getScore().render();
+            
+            float tickTime = timestep.getStepSize();
+            float secondsBack = (rewindBuffer.getNewestTick() - rewindTick) * tickTime;
+            float windowSeconds = (rewindBuffer.getNewestTick() - rewindBuffer.getOldestTick()) * tickTime;
+            menu->renderRewindOverlay(secondsBack, windowSeconds);
+            break;
+        }
     }
     
+    // O custo de renderização não inclui a espera do swap (vsync)
+    renderCost.end();
+    
     glutSwapBuffers();
+    
+    // Entradas aplicadas desde o último quadro acabaram de ir para a tela
+    // (sem glFinish: o swap pode retornar antes da imagem aparecer)
+    if (!inputsAwaitingSwap.empty()) {
+        auto now = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < inputsAwaitingSwap.size(); i++) {
+            inputToSwap.add(std::chrono::duration<double>(now - inputsAwaitingSwap[i]).count());
+        }
+        inputsAwaitingSwap.clear();
+    }
 }
 
 // Função de redimensionamento
 void reshape(int width, int height) {
-    glViewport(0, 0, width, height);
-    
-    glMatrixMode(GL_PROJECTION);
-    glLoadIdentity();
-    gluPerspective(60.0, (double)width / height, 1.0, 1000.0);
-    
-    glMatrixMode(GL_MODELVIEW);
+    // Recalcular viewport e projeções 3D/2D apenas quando a janela muda
+    Viewport::resize(width, height);
 }
 
 // Função de teclado
@@ -419,15 +541,11 @@ void keyboard(unsigned char key, int, int) {
         case PLAYING:
             switch (key) {
                 case ' ':
-                    player->jump();
+                    queuePlayerInput(INPUT_JUMP);
                     break;
                 case 27: // ESC
                     gameState = PAUSED;
-                    menu->setState(PAUSED);
-                    // Pausar música da gameplay
-                    if (audio && audio->getCurrentMusic() == "misty_effect") {
-                        audio->pauseMusic();
-                    }
+                    events.publish(EVENT_PAUSED, *world);
                     break;
                 case 'd':
                 case 'D':
@@ -445,21 +563,7 @@ void keyboard(unsigned char key, int, int) {
                 case 13: // Enter
                     if (menu->getSelectedOption() == 0) {
                         // Jogar
-                        gameState = PLAYING;
-                        score->startGame();
-                        player->reset();
-                        obstacles.clear();
-                        obstacleSpawnTimer = 0.0f;
-                        gameTime = 0.0f;
-                        speedMultiplier = 1.0f;
-                        // Parar música do menu antes de iniciar a do jogo
-                        if (audio && audio->getCurrentMusic() == "faster_than_light") {
-                            audio->stopMusic();
-                        }
-                        // Tocar música do jogo
-                        if (audio) {
-                            audio->playGameMusic();
-                        }
+                        startGame();
                     } else if (menu->getSelectedOption() == 1) {
                         // Sair
                         exit(0);
@@ -476,33 +580,21 @@ void keyboard(unsigned char key, int, int) {
                 case 'r':
                 case 'R':
                     // Reiniciar jogo
-                    gameState = PLAYING;
-                    score->startGame();
-                    player->reset();
-                    obstacles.clear();
-                    obstacleSpawnTimer = 0.0f;
-                    gameTime = 0.0f;
-                    speedMultiplier = 1.0f;
-                    // Parar música do menu antes de iniciar a do jogo
-                    if (audio && audio->getCurrentMusic() == "faster_than_light") {
-                        audio->stopMusic();
-                    }
-                    // Tocar música do jogo
-                    if (audio) {
-                        audio->playGameMusic();
-                    }
+                    startGame();
+                    break;
+                case 't':
+                case 'T':
+                    // Repetir a mesma fase
+                    retryRun();
+                    break;
+                case 'b':
+                case 'B':
+                    // Voltar alguns instantes antes da colisão
+                    startRewind();
                     break;
                 case 27: // ESC
                     gameState = MENU;
-                    menu->setState(MENU);
-                    // Parar música da gameplay antes de iniciar a do menu
-                    if (audio && audio->getCurrentMusic() == "misty_effect") {
-                        audio->stopMusic();
-                    }
-                    // Tocar música do menu
-                    if (audio) {
-                        audio->playMenuMusic();
-                    }
+                    events.publish(EVENT_MENU_OPENED, *world);
                     break;
             }
             break;
@@ -513,31 +605,40 @@ void keyboard(unsigned char key, int, int) {
                     if (menu->getSelectedOption() == 0) {
                         // Continuar
                         gameState = PLAYING;
-                        // Retomar música da gameplay
-                        if (audio && audio->getCurrentMusic() == "misty_effect") {
-                            audio->resumeMusic();
-                        }
+                        events.publish(EVENT_RESUMED, *world);
                     } else if (menu->getSelectedOption() == 1) {
-                        // Menu principal
+                        // Menu principal (a partida abandonada também é salva)
+                        finishRecording();
                         gameState = MENU;
-                        menu->setState(MENU);
-                        // Parar música da gameplay antes de iniciar a do menu
-                        if (audio && audio->getCurrentMusic() == "misty_effect") {
-                            audio->stopMusic();
-                        }
-                        // Tocar música do menu
-                        if (audio) {
-                            audio->playMenuMusic();
-                        }
+                        events.publish(EVENT_MENU_OPENED, *world);
                     }
                     break;
                 case 27: // ESC
                     gameState = PLAYING;
-                    // Retomar música da gameplay
-                    if (audio && audio->getCurrentMusic() == "misty_effect") {
-                        audio->resumeMusic();
+                    events.publish(EVENT_RESUMED, *world);
+                    break;
+                case 's':
+                case 'S':
+                    saveGameToDisk();
+                    break;
+            }
+            break;
+        
+        case REWINDING:
+            switch (key) {
+                case 13: // Enter
+                    // Continuar a partida a partir do tick mostrado (o da colisão não serve)
+                    if (!world->isGameOver()) {
+                        gameState = PLAYING;
+                        timestep.reset();
+                        events.publish(EVENT_RESUMED, *world);
                     }
                     break;
+                case 27: // ESC
+                    // Voltar para a colisão
+                    seekRewind(rewindBuffer.getNewestTick());
+                    gameState = GAME_OVER;
+                    break;
             }
             break;
     }
@@ -549,13 +650,13 @@ void specialKeys(int key, int, int) {
         case PLAYING:
             switch (key) {
                 case GLUT_KEY_LEFT:
-                    player->moveLeft();
+                    queuePlayerInput(INPUT_LEFT);
                     break;
                 case GLUT_KEY_RIGHT:
-                    player->moveRight();
+                    queuePlayerInput(INPUT_RIGHT);
                     break;
                 case GLUT_KEY_DOWN:
-                    player->slide();
+                    queuePlayerInput(INPUT_SLIDE);
                     break;
             }
             break;
@@ -573,16 +674,46 @@ void specialKeys(int key, int, int) {
             break;
             
         case GAME_OVER:
-            // Não há teclas especiais no game over
+            if (key == GLUT_KEY_LEFT) {
+                startRewind();
+            }
+            break;
+            
+        case REWINDING:
+            switch (key) {
+                case GLUT_KEY_LEFT:
+                    seekRewind(rewindTick - REWIND_STEP_TICKS);
+                    break;
+                case GLUT_KEY_RIGHT:
+                    seekRewind(rewindTick + REWIND_STEP_TICKS);
+                    break;
+            }
             break;
     }
 }
 
-// Função de timer para animação
-void timer(int) {
+// Função idle: o FramePacer decide quando começar o próximo quadro
+void idle() {
+    if (!framePacer.poll()) return;
+    framePacer.beginFrame();
     update();
     glutPostRedisplay();
-    glutTimerFunc(16, timer, 0); // ~60 FPS
+}
+
+// Aplica o modo de ritmo escolhido (precisa do contexto OpenGL criado)
+void setupFramePacing() {
+    // Sem vsync nos modos de taxa fixa e sem limite: quem marca o ritmo é o FramePacer
+    bool vsync = (pacingMode == PACING_VSYNC);
+    if (!FramePacer::applySwapInterval(vsync ? 1 : 0)) {
+        if (vsync) {
+            std::cerr << "Aviso: vsync indisponível neste driver, usando " << targetFps << " Hz fixos" << std::endl;
+            pacingMode = PACING_FIXED;
+        } else {
+            std::cerr << "Aviso: não foi possível desligar o vsync (a taxa pode ficar limitada ao monitor)" << std::endl;
+        }
+    }
+    framePacer.configure(pacingMode, targetFps);
+    std::cout << "Ritmo de quadros: " << framePacer.describe() << std::endl;
 }
 
 // Função de configuração da câmera em primeira pessoa
@@ -590,8 +721,8 @@ void setupFirstPersonCamera() {
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
     
-    // Posição da câmera na posição do jogador
-    Vector3 playerPos = player->getPosition();
+    // Posição da câmera na posição do jogador (interpolada)
+    Vector3 playerPos = world->getPlayer().getRenderPosition(renderAlpha);
     float cameraHeight = 1.5f; // Altura da câmera acima do jogador
     
     // Configurar câmera em primeira pessoa
@@ -604,9 +735,22 @@ void setupFirstPersonCamera() {
 
 // Função de limpeza
 void cleanup() {
-    delete player;
+    // Salvar partida em andamento e mostrar o resumo de desempenho
+    finishRecording();
+    reportPerformance();
+    framePacer.printSummary();
+    if (world->getLevel().getDroppedObstacles() > 0) {
+        std::cout << "Aviso: " << world->getLevel().getDroppedObstacles()
+                  << " obstáculos descartados com o pool cheio (maxObstacles = "
+                  << world->getParams().maxObstacles << ")" << std::endl;
+    }
+    
+    // Parar os assinantes com thread própria antes de destruir o resto
+    telemetry.stop();
+    telemetry.printSummary(events);
+    
+    delete world;
     delete scene;
-    delete score;
     delete menu;
     delete audio;
     
@@ -615,12 +759,77 @@ void cleanup() {
     std::cout << "Cosmic Dash finalizado!" << std::endl;
 }
 
+// Lê as opções de linha de comando (após o glutInit remover as opções do GLUT)
+bool parseArguments(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            sessionSeed = strtoull(argv[++i], NULL, 10);
+            sessionSeedSet = true;
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordFile = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            if (!replayPlayer.load(argv[++i])) {
+                return false;
+            }
+            replayMode = true;
+        } else if (strcmp(argv[i], "--load-state") == 0 && i + 1 < argc) {
+            loadStateFile = argv[++i];
+        } else if (strcmp(argv[i], "--telemetry") == 0 && i + 1 < argc) {
+            telemetryFile = argv[++i];
+        } else if (strcmp(argv[i], "--texture-cache") == 0 && i + 1 < argc) {
+            textureCacheDir = argv[++i];
+            textureCacheRequested = true;
+        } else if (strcmp(argv[i], "--no-texture-cache") == 0) {
+            textureCacheDisabled = true;
+        } else if (strcmp(argv[i], "--anisotropy") == 0 && i + 1 < argc) {
+            maxAnisotropy = (float)atof(argv[++i]);
+            if (maxAnisotropy < 1.0f) {
+                std::cerr << "--anisotropy precisa ser pelo menos 1 (1 desliga)" << std::endl;
+                return false;
+            }
+        } else if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+            targetFps = atoi(argv[++i]);
+            if (targetFps <= 0) {
+                std::cerr << "--fps precisa ser maior que zero" << std::endl;
+                return false;
+            }
+            pacingMode = PACING_FIXED;
+        } else if (strcmp(argv[i], "--vsync") == 0) {
+            pacingMode = PACING_VSYNC;
+        } else if (strcmp(argv[i], "--uncapped") == 0) {
+            pacingMode = PACING_UNCAPPED;
+        } else {
+            std::cerr << "Opção desconhecida: " << argv[i] << std::endl;
+            std::cerr << "Uso: " << argv[0] << " [--seed N] [--record arquivo] [--replay arquivo] [--load-state arquivo] [--telemetry arquivo]"
+                      << " [--texture-cache diretório | --no-texture-cache] [--anisotropy N] [--fps N | --vsync | --uncapped]" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
 // Função principal
 int main(int argc, char** argv) {
+    int windowWidth = WINDOW_WIDTH;
+    int windowHeight = WINDOW_HEIGHT;
+    
+#ifdef _WIN32
+    // Renderizar na resolução nativa em telas HiDPI (sem esticar pelo sistema)
+    SetProcessDPIAware();
+    HDC screen = GetDC(NULL);
+    float dpiScale = GetDeviceCaps(screen, LOGPIXELSX) / 96.0f;
+    ReleaseDC(NULL, screen);
+    windowWidth = (int)(WINDOW_WIDTH * dpiScale);
+    windowHeight = (int)(WINDOW_HEIGHT * dpiScale);
+#endif
+    
     // Inicializar GLUT
     glutInit(&argc, argv);
+    if (!parseArguments(argc, argv)) {
+        return 1;
+    }
     glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGB | GLUT_DEPTH);
-    glutInitWindowSize(WINDOW_WIDTH, WINDOW_HEIGHT);
+    glutInitWindowSize(windowWidth, windowHeight);
     glutInitWindowPosition(100, 100);
     glutCreateWindow("Cosmic Dash - Endless Runner Espacial");
     
@@ -629,14 +838,22 @@ int main(int argc, char** argv) {
     glutReshapeFunc(reshape);
     glutKeyboardFunc(keyboard);
     glutSpecialFunc(specialKeys);
-    glutTimerFunc(0, timer, 0);
+    glutIdleFunc(idle);
     
     // Inicializar jogo
     init();
+    setupFramePacing();
     
     // Registrar função de limpeza
     atexit(cleanup);
     
+    // No modo replay a partida começa direto
+    if (replayMode) {
+        startGame();
+    } else if (!loadStateFile.empty() && !resumeSavedGame(loadStateFile)) {
+        return 1;
+    }
+    
     std::cout << "=== COSMIC DASH ===" << std::endl;
     std::cout << "Controles:" << std::endl;
     std::cout << "  Setas <- -> : Mover entre faixas" << std::endl;
@@ -644,6 +861,9 @@ int main(int argc, char** argv) {
     std::cout << "  Espaco      : Pular" << std::endl;
     std::cout << "  V           : Alternar visão (1ª/3ª pessoa)" << std::endl;
     std::cout << "  ESC         : Menu/Pausar" << std::endl;
+    std::cout << "  S (pausado) : Salvar a partida em disco" << std::endl;
+    std::cout << "  T (game over): Repetir a mesma fase" << std::endl;
+    std::cout << "  ← ou B (game over): Rewind (voltar antes da colisão)" << std::endl;
     std::cout << "  D           : Debug mode" << std::endl;
     std::cout << "===================" << std::endl;
     
@@ -0,0 +1,156 @@
+#include "Autopilot.h"
+#include <algorithm>
+#include <cmath>
+
+const int Autopilot::DECISION_INTERVAL = 6;   // 50 ms a 120 Hz
+const int Autopilot::HORIZON_TICKS = 150;     // Um pulo inteiro e mais um pouco
+const int Autopilot::STEP_TICKS = 8;           // Ajuste fino do momento do pulo/deslize
+const int Autopilot::SEARCH_DEPTH = 3;
+
+// Folga da previsão: cobre o quanto o jogador anda entre duas amostras
+// (a troca de faixa chega a ~0,3 por tick) e arredondamentos
+static const float PATH_MARGIN = 0.4f;
+
+// "Nenhuma ação" vem primeiro: em empate, o piloto não faz nada
+static const InputAction SEARCH_ORDER[] = {
+    INPUT_ACTION_COUNT, INPUT_LEFT, INPUT_RIGHT, INPUT_JUMP, INPUT_SLIDE
+};
+static const int SEARCH_ORDER_COUNT = sizeof(SEARCH_ORDER) / sizeof(SEARCH_ORDER[0]);
+
+Autopilot::Autopilot(float tickStep) : tickStep(tickStep), rollouts(0), predictedDecisions(0) {
+    reset();
+}
+
+void Autopilot::reset() {
+    ticksUntilDecision = 0;
+}
+
+int Autopilot::evaluate(const World& world, InputAction action, int depth, int ticksLeft) {
+    rollouts++;
+    World copy = world;
+    if (action != INPUT_ACTION_COUNT) {
+        copy.applyInput(action);
+    }
+    
+    // A última ação do plano segue até o fim do horizonte
+    bool lastAction = depth + 1 >= SEARCH_DEPTH;
+    int steps = lastAction ? ticksLeft : (STEP_TICKS < ticksLeft ? STEP_TICKS : ticksLeft);
+    for (int i = 0; i < steps; i++) {
+        if (copy.tick(tickStep)) {
+            return i;
+        }
+    }
+    if (lastAction || steps == ticksLeft) {
+        return steps;
+    }
+    
+    int best = 0;
+    for (int a = 0; a < SEARCH_ORDER_COUNT; a++) {
+        int survived = evaluate(copy, SEARCH_ORDER[a], depth + 1, ticksLeft - steps);
+        if (survived > best) {
+            best = survived;
+        }
+        // Sobreviveu ao horizonte inteiro: não há plano melhor
+        if (best == ticksLeft - steps) break;
+    }
+    return steps + best;
+}
+
+bool Autopilot::isPathClear(const World& world) const {
+    const Player& player = world.getPlayer();
+    float horizon = HORIZON_TICKS * tickStep;
+    
+    // A velocidade pode subir um nível dentro do horizonte
+    float minSpeed = world.getFloorSpeed();
+    float maxSpeed = minSpeed * (1.0f + world.getParams().speedIncreaseAmount / world.getSpeedMultiplier());
+    
+    // Obstáculos que ainda vão nascer não são previstos: só vale se nenhum
+    // consegue chegar até o jogador dentro do horizonte
+    if (World::SPAWN_Z + maxSpeed * horizon > player.getMin().z - 5.0f) {
+        return false;
+    }
+    
+    Vector3 playerMin = player.getMin();
+    Vector3 playerMax = player.getMax();
+    // O deslize alonga a caixa em z; considerar sempre a maior
+    float playerMinZ = playerMin.z - 0.1f - PATH_MARGIN;
+    float playerMaxZ = playerMax.z + 0.1f + PATH_MARGIN;
+    
+    const ObstacleSystem& obstacles = world.getObstacles();
+    for (int i = 0; i < obstacles.size(); i++) {
+        Obstacle obstacle = obstacles.get(i);
+        Vector3 min = obstacle.getMin();
+        Vector3 max = obstacle.getMax();
+        
+        // Janela de tempo em que o obstáculo pode estar na profundidade do jogador
+        if (min.z > playerMaxZ) continue;   // Já passou
+        float enter = std::max(0.0f, (playerMinZ - max.z) / maxSpeed);
+        float exit = std::min(horizon, (playerMaxZ - min.z) / minSpeed);
+        if (enter > exit) continue;
+        
+        // Altura possível com a oscilação
+        float halfHeight = obstacle.size.y * 0.5f;
+        float amplitude = std::fabs(obstacles.getOscillationAmplitude(i));
+        float obstacleMinY = obstacles.getBaseY(i) - amplitude - halfHeight - PATH_MARGIN;
+        float obstacleMaxY = obstacles.getBaseY(i) + amplitude + halfHeight + PATH_MARGIN;
+        float obstacleMinX = min.x - PATH_MARGIN;
+        float obstacleMaxX = max.x + PATH_MARGIN;
+        
+        // Poses previstas ao longo da janela, a cada tick
+        for (float t = enter; ; t += tickStep) {
+            if (t > exit) t = exit;
+            Vector3 poseMin, poseMax;
+            player.getBounds(player.predict(t), poseMin, poseMax);
+            if (poseMax.x > obstacleMinX && poseMin.x < obstacleMaxX &&
+                poseMax.y > obstacleMinY && poseMin.y < obstacleMaxY) {
+                return false;
+            }
+            if (t >= exit) break;
+        }
+    }
+    return true;
+}
+
+InputAction Autopilot::decide(const World& world) {
+    // Seguir sem fazer nada é seguro: a busca também escolheria isso
+    if (isPathClear(world)) {
+        predictedDecisions++;
+        return INPUT_ACTION_COUNT;
+    }
+    
+    InputAction bestAction = INPUT_ACTION_COUNT;
+    int best = -1;
+    for (int a = 0; a < SEARCH_ORDER_COUNT; a++) {
+        int survived = evaluate(world, SEARCH_ORDER[a], 0, HORIZON_TICKS);
+        if (survived > best) {
+            best = survived;
+            bestAction = SEARCH_ORDER[a];
+        }
+        if (best == HORIZON_TICKS) break;
+    }
+    return bestAction;
+}
+
+InputAction Autopilot::control(World& world) {
+    if (--ticksUntilDecision > 0) {
+        return INPUT_ACTION_COUNT;
+    }
+    ticksUntilDecision = DECISION_INTERVAL;
+    
+    InputAction action = decide(world);
+    if (action != INPUT_ACTION_COUNT) {
+        world.applyInput(action);
+    }
+    return action;
+}
+
+bool Autopilot::play(World& world, float maxTime) {
+    reset();
+    while (world.getGameTime() < maxTime) {
+        control(world);
+        if (world.tick(tickStep)) {
+            return true;
+        }
+    }
+    return false;
+}
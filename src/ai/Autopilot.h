@@ -0,0 +1,58 @@
+#ifndef AUTOPILOT_H
+#define AUTOPILOT_H
+
+#include "../world/World.h"
+
+// Piloto automático: joga pelos mesmos comandos do jogador (World::applyInput,
+// que chama Player::moveLeft/moveRight/jump/slide). A cada decisão faz uma
+// busca de horizonte curto sobre cópias do World: tenta cada ação agora e
+// cada ação de novo um pouco depois, simulando tick a tick, e fica com o
+// plano que sobrevive mais tempo (preferindo não fazer nada).
+//
+// Antes da busca, uma previsão sem simulação (Player::predict contra o
+// movimento dos obstáculos em z) verifica se não fazer nada é seguro no
+// horizonte inteiro; nesse caso a busca escolheria a mesma coisa e é pulada.
+class Autopilot {
+private:
+    float tickStep;
+    int ticksUntilDecision;
+    long long rollouts;      // Simulações feitas na busca (estatística)
+    long long predictedDecisions;  // Decisões resolvidas só pela previsão
+    
+    // Quantos ticks a ação sobrevive (até o fim do horizonte) a partir de world
+    int evaluate(const World& world, InputAction action, int depth, int ticksLeft);
+    
+public:
+    // Ticks entre decisões (tempo de reação)
+    static const int DECISION_INTERVAL;
+    // Ticks simulados à frente em cada decisão
+    static const int HORIZON_TICKS;
+    // Ticks entre as ações de um plano, e quantas ações cada plano tem
+    static const int STEP_TICKS;
+    static const int SEARCH_DEPTH;
+    
+    explicit Autopilot(float tickStep = 1.0f / 120.0f);
+    
+    // Nova partida
+    void reset();
+    
+    // Escolhe a melhor ação para o estado atual (INPUT_ACTION_COUNT = nenhuma)
+    InputAction decide(const World& world);
+    
+    // true se, sem nenhum comando, o jogador certamente atravessa o horizonte
+    // sem colidir (conservador: na dúvida retorna false)
+    bool isPathClear(const World& world) const;
+    
+    // Chamado antes de cada tick: decide a cada DECISION_INTERVAL ticks e
+    // aplica a ação escolhida; retorna a ação aplicada (ou INPUT_ACTION_COUNT)
+    InputAction control(World& world);
+    
+    // Joga a partida até colidir ou até maxTime segundos de jogo;
+    // retorna true se colidiu
+    bool play(World& world, float maxTime);
+    
+    long long getRollouts() const { return rollouts; }
+    long long getPredictedDecisions() const { return predictedDecisions; }
+};
+
+#endif // AUTOPILOT_H
@@ -7,10 +7,19 @@
     #include <windows.h>
     #include <mmsystem.h>
     #include <thread>
-    #include <chrono>
 #endif
+#include <chrono>
 
-Audio::Audio() : currentMusic(""), isInitialized(false) {
+// Nome do arquivo (sem extensão) de cada faixa
+static const char* trackName(MusicTrack track) {
+    switch (track) {
+        case MUSIC_MENU: return "faster_than_light";
+        case MUSIC_GAME: return "misty_effect";
+        default:         return "";
+    }
+}
+
+Audio::Audio() : currentTrack(MUSIC_NONE), isInitialized(false), events(NULL), eventsRunning(false) {
 #ifdef _WIN32
     musicPlaying = false;
     shouldStopMusic = false;
@@ -57,6 +66,7 @@ void Audio::update() {
 }
 
 void Audio::cleanup() {
+    stopEventThread();
 #ifdef _WIN32
     stopMusicWindows();
     if (musicThread.joinable()) {
@@ -72,7 +82,7 @@ void Audio::playMenuMusic() {
     // Parar música atual se estiver tocando
     stopMusic();
     
-    currentMusic = "faster_than_light";
+    currentTrack = MUSIC_MENU;
     std::cout << "Iniciando música do menu..." << std::endl;
     
 #ifdef _WIN32
@@ -102,7 +112,7 @@ void Audio::playGameMusic() {
     // Parar música atual se estiver tocando
     stopMusic();
     
-    currentMusic = "misty_effect";
+    currentTrack = MUSIC_GAME;
     std::cout << "Iniciando música do jogo..." << std::endl;
     
 #ifdef _WIN32
@@ -133,9 +143,9 @@ void Audio::stopMusic() {
     stopMusicWindows();
 #endif
     
-    if (!currentMusic.empty()) {
-        std::cout << "⏹ Parando música: " << currentMusic << std::endl;
-        currentMusic = "";
+    if (currentTrack != MUSIC_NONE) {
+        std::cout << "⏹ Parando música: " << trackName(currentTrack) << std::endl;
+        currentTrack = MUSIC_NONE;
     }
 }
 
@@ -145,7 +155,7 @@ void Audio::pauseMusic() {
 #ifdef _WIN32
     if (musicPlaying) {
         mciSendStringA("pause music", NULL, 0, NULL);
-        std::cout << "⏸ Música pausada: " << currentMusic << std::endl;
+        std::cout << "⏸ Música pausada: " << trackName(currentTrack) << std::endl;
     }
 #endif
 }
@@ -154,15 +164,15 @@ void Audio::resumeMusic() {
     if (!isInitialized) return;
     
 #ifdef _WIN32
-    if (musicPlaying && !currentMusic.empty()) {
+    if (musicPlaying && currentTrack != MUSIC_NONE) {
         mciSendStringA("resume music", NULL, 0, NULL);
-        std::cout << "▶ Música retomada: " << currentMusic << std::endl;
+        std::cout << "▶ Música retomada: " << trackName(currentTrack) << std::endl;
     } else {
         // Reiniciar música se não estiver tocando
-        std::cout << "🔄 Reiniciando música: " << currentMusic << std::endl;
-        if (currentMusic == "faster_than_light") {
+        std::cout << "🔄 Reiniciando música: " << trackName(currentTrack) << std::endl;
+        if (currentTrack == MUSIC_MENU) {
             playMenuMusic();
-        } else if (currentMusic == "misty_effect") {
+        } else if (currentTrack == MUSIC_GAME) {
             playGameMusic();
         }
     }
@@ -204,13 +214,61 @@ bool Audio::isMusicPlaying() {
 }
 
 std::string Audio::getCurrentMusic() {
-    return currentMusic;
+    return trackName(currentTrack);
 }
 
 bool Audio::isAudioWorking() {
     return isInitialized;
 }
 
+void Audio::handleEvent(const GameEvent& event) {
+    switch (event.type) {
+        case EVENT_GAME_STARTED:
+            // playGameMusic já para a música do menu
+            playGameMusic();
+            break;
+        case EVENT_PAUSED:
+            if (currentTrack == MUSIC_GAME) {
+                pauseMusic();
+            }
+            break;
+        case EVENT_RESUMED:
+            if (currentTrack == MUSIC_GAME) {
+                resumeMusic();
+            }
+            break;
+        case EVENT_MENU_OPENED:
+            playMenuMusic();
+            break;
+        default:
+            break;
+    }
+}
+
+void Audio::startEventThread(EventBus& bus) {
+    if (eventsRunning) return;
+    events = bus.subscribe("audio", EventBus::DEFAULT_CAPACITY, &eventsWake);
+    eventsRunning = true;
+    eventThread = std::thread(&Audio::eventLoop, this);
+}
+
+void Audio::stopEventThread() {
+    if (!eventsRunning) return;
+    eventsRunning = false;
+    eventsWake.post();
+    eventThread.join();
+}
+
+void Audio::eventLoop() {
+    GameEvent event;
+    while (eventsRunning) {
+        while (events->pop(event)) {
+            handleEvent(event);
+        }
+        eventsWake.wait();
+    }
+}
+
 #ifdef _WIN32
 void Audio::playMusicWindows(const std::string& filename, bool loop) {
     // Parar música atual primeiro
@@ -5,6 +5,7 @@
 #include <thread>
 #include <atomic>
 #include <vector>
+#include "../events/EventBus.h"
 
 #ifdef _WIN32
     #include <windows.h>
@@ -12,6 +13,13 @@
     // Note: -lwinmm is specified in Makefile instead of pragma comment
 #endif
 
+// Faixas de música do jogo
+enum MusicTrack {
+    MUSIC_NONE,
+    MUSIC_MENU,     // faster_than_light
+    MUSIC_GAME      // misty_effect
+};
+
 class Audio {
 private:
 #ifdef _WIN32
@@ -21,9 +29,18 @@ private:
     std::atomic<bool> shouldStopMusic;
 #endif
     
-    std::string currentMusic;
+    // Escrita pela thread de eventos, lida pela thread do GLUT
+    std::atomic<MusicTrack> currentTrack;
     bool isInitialized;
     
+    // Assinatura do EventBus: a música reage às transições numa thread
+    // própria (parar a música espera a thread do MCI terminar)
+    EventBus::Queue* events;
+    std::thread eventThread;
+    Semaphore eventsWake;
+    std::atomic<bool> eventsRunning;
+    void eventLoop();
+    
 public:
     Audio();
     ~Audio();
@@ -39,8 +56,14 @@ public:
     float getMusicVolume();
     bool isMusicPlaying();
     std::string getCurrentMusic();
+    MusicTrack getCurrentTrack() const { return currentTrack.load(); }
     bool isAudioWorking();
     
+    // Troca de música conforme o evento da partida
+    void handleEvent(const GameEvent& event);
+    void startEventThread(EventBus& bus);
+    void stopEventThread();
+    
 #ifdef _WIN32
 private:
     void playMusicWindows(const std::string& filename, bool loop = true);
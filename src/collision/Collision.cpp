@@ -1,6 +1,13 @@
 #include "Collision.h"
+#include "../obstacle/ObstacleArchetype.h"
+#include <algorithm>
 #include <vector>
 
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define COLLISION_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
 bool Collision::checkAABB(const Vector3& min1, const Vector3& max1,
                          const Vector3& min2, const Vector3& max2) {
     return (min1.x <= max2.x && max1.x >= min2.x) &&
@@ -8,123 +15,200 @@ bool Collision::checkAABB(const Vector3& min1, const Vector3& max1,
            (min1.z <= max2.z && max1.z >= min2.z);
 }
 
-bool Collision::checkCollision(const Player& player, const Obstacle& obstacle) {
-    if (!obstacle.isActive()) return false;
-    
-    Vector3 playerMin = player.getMin();
-    Vector3 playerMax = player.getMax();
-    Vector3 obstacleMin = obstacle.getMin();
-    Vector3 obstacleMax = obstacle.getMax();
-    
-    // Verificar colisão básica AABB
-    bool basicCollision = checkAABB(playerMin, playerMax, obstacleMin, obstacleMax);
-    
-    // Se não há colisão básica, não há colisão
-    if (!basicCollision) return false;
+// Sobreposição de uma caixa com a caixa i dos arrays SoA
+static inline bool overlapsAt(const Vector3& min, const Vector3& max,
+                              const float* minX, const float* minY, const float* minZ,
+                              const float* maxX, const float* maxY, const float* maxZ, int i) {
+    return (min.x <= maxX[i] && max.x >= minX[i]) &&
+           (min.y <= maxY[i] && max.y >= minY[i]) &&
+           (min.z <= maxZ[i] && max.z >= minZ[i]);
+}
+
+#ifdef COLLISION_SIMD_X86
+// Máscara de 4 bits com as caixas [i, i + 4) que se sobrepõem
+__attribute__((target("sse2")))
+static inline int overlapMask4(const Vector3& min, const Vector3& max,
+                               const float* minX, const float* minY, const float* minZ,
+                               const float* maxX, const float* maxY, const float* maxZ, int i) {
+    __m128 hit = _mm_and_ps(_mm_cmple_ps(_mm_set1_ps(min.x), _mm_loadu_ps(maxX + i)),
+                            _mm_cmpge_ps(_mm_set1_ps(max.x), _mm_loadu_ps(minX + i)));
+    hit = _mm_and_ps(hit, _mm_cmple_ps(_mm_set1_ps(min.y), _mm_loadu_ps(maxY + i)));
+    hit = _mm_and_ps(hit, _mm_cmpge_ps(_mm_set1_ps(max.y), _mm_loadu_ps(minY + i)));
+    hit = _mm_and_ps(hit, _mm_cmple_ps(_mm_set1_ps(min.z), _mm_loadu_ps(maxZ + i)));
+    hit = _mm_and_ps(hit, _mm_cmpge_ps(_mm_set1_ps(max.z), _mm_loadu_ps(minZ + i)));
+    return _mm_movemask_ps(hit);
+}
+
+static bool hasSSE2() {
+    static const bool supported = __builtin_cpu_supports("sse2");
+    return supported;
+}
+#endif
+
+int Collision::checkAABBBatch(const Vector3& min, const Vector3& max,
+                              const float* minX, const float* minY, const float* minZ,
+                              const float* maxX, const float* maxY, const float* maxZ,
+                              int count, uint32_t* hitMask) {
+    for (int word = 0; word < (count + 31) / 32; word++) {
+        hitMask[word] = 0;
+    }
     
-    // Lógica específica para cada tipo de obstáculo
-    switch (obstacle.getType()) {
-        case STATIC:
-            // Obstáculo vermelho: no chão, pode pular ou desviar
-            // Se o jogador está deslizando, MORRE (não pode deslizar sobre obstáculo no chão)
-            if (player.getIsSliding()) {
-                return true; // Colisão = morte
-            }
-            // Se não está deslizando, colisão normal
-            return basicCollision;
-            
-        case MOVING_VERTICAL:
-            // Obstáculo móvel: comportamento similar ao estático
-            if (player.getIsSliding()) {
-                return true; // Colisão = morte
-            }
-            return basicCollision;
-            
-        case ROCKET:
-            // Foguete: muito alto, só pode desviar
-            if (player.getIsSliding()) {
-                return true; // Colisão = morte
+    int hits = 0;
+    int i = 0;
+#ifdef COLLISION_SIMD_X86
+    if (hasSSE2()) {
+        for (; i + 4 <= count; i += 4) {
+            uint32_t mask = (uint32_t)overlapMask4(min, max, minX, minY, minZ, maxX, maxY, maxZ, i);
+            if (mask) {
+                // i é múltiplo de 4: os 4 bits nunca cruzam a fronteira da palavra
+                hitMask[i / 32] |= mask << (i % 32);
+                hits += __builtin_popcount(mask);
             }
-            return basicCollision;
-            
-        case HIGH_OBSTACLE:
-            // Obstáculo roxo: elevado, só pode deslizar embaixo ou desviar
-            if (player.getIsSliding()) {
-                // Se está deslizando E está embaixo do obstáculo, não há colisão
-                if (playerMax.y < obstacleMin.y) {
-                    return false; // Passa embaixo
-                }
-            }
-            // Se não está deslizando ou está tocando o obstáculo, há colisão
-            return true;
-            
-        default:
-            return basicCollision;
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        if (overlapsAt(min, max, minX, minY, minZ, maxX, maxY, maxZ, i)) {
+            hitMask[i / 32] |= 1u << (i % 32);
+            hits++;
+        }
     }
+    return hits;
 }
 
-bool Collision::checkCollisionWithObstacles(const Player& player, 
-                                           const std::vector<Obstacle>& obstacles) {
-    for (const auto& obstacle : obstacles) {
-        if (checkCollision(player, obstacle)) {
-            return true;
+int Collision::findFirstAABBHit(const Vector3& min, const Vector3& max,
+                                const float* minX, const float* minY, const float* minZ,
+                                const float* maxX, const float* maxY, const float* maxZ,
+                                int begin, int end) {
+    int i = begin;
+#ifdef COLLISION_SIMD_X86
+    if (hasSSE2()) {
+        for (; i + 4 <= end; i += 4) {
+            int mask = overlapMask4(min, max, minX, minY, minZ, maxX, maxY, maxZ, i);
+            if (mask) {
+                return i + __builtin_ctz(mask);
+            }
         }
     }
-    return false;
+#endif
+    for (; i < end; i++) {
+        if (overlapsAt(min, max, minX, minY, minZ, maxX, maxY, maxZ, i)) {
+            return i;
+        }
+    }
+    return -1;
 }
 
-void Collision::renderBoundingBox(const Vector3& min, const Vector3& max) {
-    glColor3f(1.0f, 0.0f, 0.0f); // Vermelho para debug
-    glLineWidth(1.0f);
-    
-    glBegin(GL_LINES);
-    // Arestas inferiores
-    glVertex3f(min.x, min.y, min.z);
-    glVertex3f(max.x, min.y, min.z);
-    
-    glVertex3f(max.x, min.y, min.z);
-    glVertex3f(max.x, min.y, max.z);
-    
-    glVertex3f(max.x, min.y, max.z);
-    glVertex3f(min.x, min.y, max.z);
-    
-    glVertex3f(min.x, min.y, max.z);
-    glVertex3f(min.x, min.y, min.z);
-    
-    // Arestas superiores
-    glVertex3f(min.x, max.y, min.z);
-    glVertex3f(max.x, max.y, min.z);
-    
-    glVertex3f(max.x, max.y, min.z);
-    glVertex3f(max.x, max.y, max.z);
-    
-    glVertex3f(max.x, max.y, max.z);
-    glVertex3f(min.x, max.y, max.z);
-    
-    glVertex3f(min.x, max.y, max.z);
-    glVertex3f(min.x, max.y, min.z);
-    
-    // Arestas verticais
-    glVertex3f(min.x, min.y, min.z);
-    glVertex3f(min.x, max.y, min.z);
+bool Collision::checkCollision(const Player& player, const Obstacle& obstacle) {
+    // Verificar colisão básica AABB
+    bool basicCollision = checkAABB(player.getMin(), player.getMax(), obstacle.getMin(), obstacle.getMax());
     
-    glVertex3f(max.x, min.y, min.z);
-    glVertex3f(max.x, max.y, min.z);
+    // Se não há colisão básica, não há colisão
+    if (!basicCollision) return false;
     
-    glVertex3f(max.x, min.y, max.z);
-    glVertex3f(max.x, max.y, max.z);
+    return checkTypeRules(player, obstacle);
+}
+
+// Intervalo de tempo [entry, exit] em que dois intervalos de um eixo se
+// sobrepõem, sendo que o segundo se desloca "move" em relação ao primeiro
+static bool sweepAxis(float minA, float maxA, float minB, float maxB, float move,
+                      float& entry, float& exit) {
+    if (move == 0.0f) {
+        // Sem movimento relativo: ou se sobrepõem o tick inteiro, ou nunca
+        entry = -1e30f;
+        exit = 1e30f;
+        return minA <= maxB && maxA >= minB;
+    }
+    if (move > 0.0f) {
+        entry = (minA - maxB) / move;
+        exit = (maxA - minB) / move;
+    } else {
+        entry = (maxA - minB) / move;
+        exit = (minA - maxB) / move;
+    }
+    return true;
+}
+
+bool Collision::sweepAABB(const Vector3& minA, const Vector3& maxA, const Vector3& moveA,
+                          const Vector3& minB, const Vector3& maxB, const Vector3& moveB,
+                          float& timeOfImpact) {
+    Vector3 move = moveB - moveA;
+    float entryX, exitX, entryY, exitY, entryZ, exitZ;
+    
+    if (!sweepAxis(minA.x, maxA.x, minB.x, maxB.x, move.x, entryX, exitX)) return false;
+    if (!sweepAxis(minA.y, maxA.y, minB.y, maxB.y, move.y, entryY, exitY)) return false;
+    if (!sweepAxis(minA.z, maxA.z, minB.z, maxB.z, move.z, entryZ, exitZ)) return false;
+    
+    // Há contato quando os três eixos se sobrepõem ao mesmo tempo dentro do tick
+    float entry = std::max(entryX, std::max(entryY, entryZ));
+    float exit = std::min(exitX, std::min(exitY, exitZ));
+    if (entry > exit || entry > 1.0f || exit < 0.0f) return false;
+    
+    timeOfImpact = std::max(entry, 0.0f);
+    return true;
+}
+
+bool Collision::checkSweptCollision(const Player& player, const Obstacle& obstacle) {
+    // Caixas no início do tick (mesmas dimensões de agora)
+    Vector3 playerMove = player.getPosition() - player.getPreviousPosition();
+    Vector3 obstacleMove = obstacle.position - obstacle.previousPosition;
+    
+    float timeOfImpact;
+    if (!sweepAABB(player.getMin() - playerMove, player.getMax() - playerMove, playerMove,
+                   obstacle.getMin() - obstacleMove, obstacle.getMax() - obstacleMove, obstacleMove,
+                   timeOfImpact)) {
+        return false;
+    }
     
-    glVertex3f(min.x, min.y, max.z);
-    glVertex3f(min.x, max.y, max.z);
-    glEnd();
+    return checkTypeRules(player, obstacle);
 }
 
-void Collision::renderPlayerBoundingBox(const Player& player) {
-    renderBoundingBox(player.getMin(), player.getMax());
+bool Collision::checkTypeRules(const Player& player, const Obstacle& obstacle) {
+    Vector3 playerMax = player.getMax();
+    Vector3 obstacleMin = obstacle.getMin();
+    
+    // Regra específica do tipo de obstáculo
+    if (getArchetype(obstacle.getType()).collisionRule == RULE_SLIDE_UNDER && player.getIsSliding()) {
+        // Se está deslizando E está embaixo do obstáculo, não há colisão
+        if (playerMax.y < obstacleMin.y) {
+            return false; // Passa embaixo
+        }
+    }
+    // Nos demais casos (inclusive deslizando contra obstáculo no chão), colisão = morte
+    return true;
 }
 
-void Collision::renderObstacleBoundingBox(const Obstacle& obstacle) {
-    if (obstacle.isActive()) {
-        renderBoundingBox(obstacle.getMin(), obstacle.getMax());
+bool Collision::checkCollisionWithObstacles(const Player& player, 
+                                           const ObstacleSystem& obstacles,
+                                           const LaneIndex& laneIndex) {
+    // Caixa varrida pelo jogador no último tick (o índice guarda as dos obstáculos)
+    Vector3 playerMove = player.getPosition() - player.getPreviousPosition();
+    Vector3 min = player.getMin();
+    Vector3 max = player.getMax();
+    Vector3 playerMin(std::min(min.x, min.x - playerMove.x), std::min(min.y, min.y - playerMove.y), std::min(min.z, min.z - playerMove.z));
+    Vector3 playerMax(std::max(max.x, max.x - playerMove.x), std::max(max.y, max.y - playerMove.y), std::max(max.z, max.z - playerMove.z));
+    
+    // Faixas que o jogador pode ocupar: da atual até a de destino
+    int firstLane = std::min(player.getCurrentLane(), player.getTargetLane());
+    int lastLane = std::max(player.getCurrentLane(), player.getTargetLane());
+    
+    for (int lane = firstLane; lane <= lastLane; lane++) {
+        const LaneIndex::Bucket& bucket = laneIndex.getBucket(lane);
+        int begin, end;
+        laneIndex.findRange(lane, playerMin.z, playerMax.z, begin, end);
+        
+        // Teste AABB em lote das caixas varridas; o teste contínuo e as regras
+        // de tipo só rodam para quem se sobrepõe
+        int hit = begin;
+        while ((hit = findFirstAABBHit(playerMin, playerMax,
+                                       bucket.minX.data(), bucket.minY.data(), bucket.minZ.data(),
+                                       bucket.maxX.data(), bucket.maxY.data(), bucket.maxZ.data(),
+                                       hit, end)) >= 0) {
+            if (checkSweptCollision(player, obstacles.get(bucket.index[hit]))) {
+                return true;
+            }
+            hit++;
+        }
     }
-} 
\ No newline at end of file
+    return false;
+}
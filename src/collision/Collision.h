@@ -3,7 +3,9 @@
 
 #include "../utils/Vector3.h"
 #include "../player/Player.h"
-#include "../obstacle/Obstacle.h"
+#include "../obstacle/ObstacleSystem.h"
+#include "LaneIndex.h"
+#include <cstdint>
 #include <vector>
 
 class Collision {
@@ -12,12 +14,43 @@ public:
     static bool checkAABB(const Vector3& min1, const Vector3& max1,
                          const Vector3& min2, const Vector3& max2);
     
-    // Sobrecarga para objetos específicos
+    // Teste em lote: uma caixa contra count caixas em arrays SoA (SIMD).
+    // Escreve um bit por caixa em hitMask ((count + 31) / 32 palavras) e
+    // retorna quantas caixas se sobrepõem
+    static int checkAABBBatch(const Vector3& min, const Vector3& max,
+                              const float* minX, const float* minY, const float* minZ,
+                              const float* maxX, const float* maxY, const float* maxZ,
+                              int count, uint32_t* hitMask);
+    
+    // Índice da primeira caixa em [begin, end) que se sobrepõe, ou -1
+    static int findFirstAABBHit(const Vector3& min, const Vector3& max,
+                                const float* minX, const float* minY, const float* minZ,
+                                const float* maxX, const float* maxY, const float* maxZ,
+                                int begin, int end);
+    
+    // Colisão contínua (swept AABB): as caixas A e B partem de min/max e se
+    // deslocam moveA/moveB ao longo do tick. Retorna true se elas se tocam em
+    // algum instante do tick; timeOfImpact recebe o primeiro (0 a 1)
+    static bool sweepAABB(const Vector3& minA, const Vector3& maxA, const Vector3& moveA,
+                          const Vector3& minB, const Vector3& maxB, const Vector3& moveB,
+                          float& timeOfImpact);
+    
+    // Sobrecarga para objetos específicos (estado no fim do tick)
     static bool checkCollision(const Player& player, const Obstacle& obstacle);
     
-    // Verificação de colisão com múltiplos obstáculos
+    // Como checkCollision, mas considerando todo o movimento do último tick:
+    // um obstáculo rápido não atravessa o jogador entre dois ticks
+    static bool checkSweptCollision(const Player& player, const Obstacle& obstacle);
+    
+    // Regras de cada tipo (deslizar sob HIGH_OBSTACLE etc.), aplicadas a um
+    // obstáculo cuja caixa já se sobrepõe à do jogador
+    static bool checkTypeRules(const Player& player, const Obstacle& obstacle);
+    
+    // Verificação de colisão (contínua) com múltiplos obstáculos (broadphase
+    // pelo índice de faixas: só testa os obstáculos próximos nas faixas do jogador)
     static bool checkCollisionWithObstacles(const Player& player, 
-                                           const std::vector<Obstacle>& obstacles);
+                                           const ObstacleSystem& obstacles,
+                                           const LaneIndex& laneIndex);
     
     // Utilitários para debug
     static void renderBoundingBox(const Vector3& min, const Vector3& max);
@@ -0,0 +1,58 @@
+#include "Collision.h"
+#include <GL/glut.h>
+
+// Visualização das bounding boxes (modo debug)
+
+void Collision::renderBoundingBox(const Vector3& min, const Vector3& max) {
+    glColor3f(1.0f, 0.0f, 0.0f); // Vermelho para debug
+    glLineWidth(1.0f);
+    
+    glBegin(GL_LINES);
+    // Arestas inferiores
+    glVertex3f(min.x, min.y, min.z);
+    glVertex3f(max.x, min.y, min.z);
+    
+    glVertex3f(max.x, min.y, min.z);
+    glVertex3f(max.x, min.y, max.z);
+    
+    glVertex3f(max.x, min.y, max.z);
+    glVertex3f(min.x, min.y, max.z);
+    
+    glVertex3f(min.x, min.y, max.z);
+    glVertex3f(min.x, min.y, min.z);
+    
+    // Arestas superiores
+    glVertex3f(min.x, max.y, min.z);
+    glVertex3f(max.x, max.y, min.z);
+    
+    glVertex3f(max.x, max.y, min.z);
+    glVertex3f(max.x, max.y, max.z);
+    
+    glVertex3f(max.x, max.y, max.z);
+    glVertex3f(min.x, max.y, max.z);
+    
+    glVertex3f(min.x, max.y, max.z);
+    glVertex3f(min.x, max.y, min.z);
+    
+    // Arestas verticais
+    glVertex3f(min.x, min.y, min.z);
+    glVertex3f(min.x, max.y, min.z);
+    
+    glVertex3f(max.x, min.y, min.z);
+    glVertex3f(max.x, max.y, min.z);
+    
+    glVertex3f(max.x, min.y, max.z);
+    glVertex3f(max.x, max.y, max.z);
+    
+    glVertex3f(min.x, min.y, max.z);
+    glVertex3f(min.x, max.y, max.z);
+    glEnd();
+}
+
+void Collision::renderPlayerBoundingBox(const Player& player) {
+    renderBoundingBox(player.getMin(), player.getMax());
+}
+
+void Collision::renderObstacleBoundingBox(const Obstacle& obstacle) {
+    renderBoundingBox(obstacle.getMin(), obstacle.getMax());
+}
@@ -0,0 +1,113 @@
+#include "LaneIndex.h"
+#include <algorithm>
+#include <cmath>
+
+const float LaneIndex::LANE_WIDTH = 3.0f;
+
+void LaneIndex::Bucket::clear() {
+    minX.clear(); minY.clear(); minZ.clear();
+    maxX.clear(); maxY.clear(); maxZ.clear();
+    index.clear();
+}
+
+void LaneIndex::Bucket::resize(int count) {
+    minX.resize(count); minY.resize(count); minZ.resize(count);
+    maxX.resize(count); maxY.resize(count); maxZ.resize(count);
+    index.resize(count);
+}
+
+void LaneIndex::Bucket::append(const Vector3& min, const Vector3& max, int obstacleIndex) {
+    minX.push_back(min.x); minY.push_back(min.y); minZ.push_back(min.z);
+    maxX.push_back(max.x); maxY.push_back(max.y); maxZ.push_back(max.z);
+    index.push_back(obstacleIndex);
+}
+
+void LaneIndex::Bucket::swap(Bucket& other) {
+    minX.swap(other.minX); minY.swap(other.minY); minZ.swap(other.minZ);
+    maxX.swap(other.maxX); maxY.swap(other.maxY); maxZ.swap(other.maxZ);
+    index.swap(other.index);
+}
+
+int LaneIndex::laneForX(float x) {
+    int lane = (int)std::floor(x / LANE_WIDTH + 0.5f) + 1;
+    if (lane < 0) return 0;
+    if (lane >= LANE_COUNT) return LANE_COUNT - 1;
+    return lane;
+}
+
+LaneIndex::LaneIndex() {
+    for (int lane = 0; lane < LANE_COUNT; lane++) {
+        maxDepth[lane] = 0.0f;
+    }
+}
+
+void LaneIndex::sortByMinZ(Bucket& bucket) {
+    const std::vector<float>& keys = bucket.minZ;
+    if (std::is_sorted(keys.begin(), keys.end())) return;
+    
+    int count = bucket.size();
+    order.resize(count);
+    for (int i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    // Empates ficam na ordem de inserção, sem depender de um sort estável
+    std::sort(order.begin(), order.end(), [&keys](int a, int b) {
+        return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+    });
+    
+    // Aplicar a permutação no bucket de trabalho e trocar os arrays: depois
+    // do primeiro tick os dois já têm capacidade e nada é alocado
+    scratch.resize(count);
+    for (int i = 0; i < count; i++) {
+        int from = order[i];
+        scratch.minX[i] = bucket.minX[from];
+        scratch.minY[i] = bucket.minY[from];
+        scratch.minZ[i] = bucket.minZ[from];
+        scratch.maxX[i] = bucket.maxX[from];
+        scratch.maxY[i] = bucket.maxY[from];
+        scratch.maxZ[i] = bucket.maxZ[from];
+        scratch.index[i] = bucket.index[from];
+    }
+    bucket.swap(scratch);
+}
+
+void LaneIndex::build(const ObstacleSystem& obstacles) {
+    for (int lane = 0; lane < LANE_COUNT; lane++) {
+        buckets[lane].clear();
+        maxDepth[lane] = 0.0f;
+    }
+    
+    // Os mais novos (mais ao fundo) ficam no fim dos arrays densos: percorrer
+    // de trás para frente deixa cada faixa quase sempre já em ordem de z
+    for (int i = obstacles.size() - 1; i >= 0; i--) {
+        Obstacle obstacle = obstacles.get(i);
+        int lane = laneForX(obstacle.position.x);
+        
+        // Caixa varrida: união das caixas no início e no fim do tick
+        Vector3 offset = obstacle.previousPosition - obstacle.position;
+        Vector3 min = obstacle.getMin();
+        Vector3 max = obstacle.getMax();
+        Vector3 sweptMin(std::min(min.x, min.x + offset.x), std::min(min.y, min.y + offset.y), std::min(min.z, min.z + offset.z));
+        Vector3 sweptMax(std::max(max.x, max.x + offset.x), std::max(max.y, max.y + offset.y), std::max(max.z, max.z + offset.z));
+        
+        buckets[lane].append(sweptMin, sweptMax, i);
+        
+        float depth = sweptMax.z - sweptMin.z;
+        if (depth > maxDepth[lane]) {
+            maxDepth[lane] = depth;
+        }
+    }
+    
+    // Só reordena as faixas fora de ordem (depois de um swap-remove)
+    for (int lane = 0; lane < LANE_COUNT; lane++) {
+        sortByMinZ(buckets[lane]);
+    }
+}
+
+void LaneIndex::findRange(int lane, float zMin, float zMax, int& begin, int& end) const {
+    const std::vector<float>& minZ = buckets[lane].minZ;
+    
+    // Só podem cruzar a janela os que começam em [zMin - maxDepth, zMax]
+    begin = (int)(std::lower_bound(minZ.begin(), minZ.end(), zMin - maxDepth[lane]) - minZ.begin());
+    end = (int)(std::upper_bound(minZ.begin() + begin, minZ.end(), zMax) - minZ.begin());
+}
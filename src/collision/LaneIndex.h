@@ -0,0 +1,61 @@
+#ifndef LANE_INDEX_H
+#define LANE_INDEX_H
+
+#include "../obstacle/ObstacleSystem.h"
+#include <vector>
+
+// Índice espacial da broadphase de colisão.
+//
+// Os obstáculos são separados por faixa e, dentro de cada faixa, ordenados
+// pelo início em z. As caixas (AABB) guardadas são as varridas no último
+// tick (união do início e do fim), para a colisão contínua, e ficam em arrays SoA
+// (minX..maxZ), prontos para o teste em lote de Collision. Uma consulta
+// devolve o trecho contíguo da faixa que pode cruzar uma janela em z, com
+// busca binária - o custo não cresce com os obstáculos fora da janela.
+class LaneIndex {
+public:
+    static const int LANE_COUNT = 3;
+    static const float LANE_WIDTH;
+    
+    // Caixas de uma faixa, ordenadas por minZ
+    struct Bucket {
+        std::vector<float> minX, minY, minZ;
+        std::vector<float> maxX, maxY, maxZ;
+        std::vector<int> index; // índice denso no ObstacleSystem
+        
+        int size() const { return (int)index.size(); }
+        void clear();
+        void resize(int count);
+        void append(const Vector3& min, const Vector3& max, int obstacleIndex);
+        // Troca os arrays com outro bucket (sem copiar nem alocar)
+        void swap(Bucket& other);
+    };
+    
+    // Faixa (0 = esquerda, 1 = centro, 2 = direita) mais próxima de uma posição x
+    static int laneForX(float x);
+    // Centro em x de uma faixa (inverso de laneForX)
+    static float laneCenterX(int lane) { return (lane - 1) * LANE_WIDTH; }
+    
+    LaneIndex();
+    
+    // Reconstrói o índice a partir dos obstáculos vivos (uma vez por tick)
+    void build(const ObstacleSystem& obstacles);
+    
+    // Trecho [begin, end) da faixa com os obstáculos que podem cruzar [zMin, zMax]
+    void findRange(int lane, float zMin, float zMax, int& begin, int& end) const;
+    
+    const Bucket& getBucket(int lane) const { return buckets[lane]; }
+    
+private:
+    // Ordena o bucket por minZ; nada a fazer se já estiver em ordem
+    void sortByMinZ(Bucket& bucket);
+    
+    Bucket buckets[LANE_COUNT];
+    // Maior profundidade (maxZ - minZ) de cada faixa, para limitar a busca
+    float maxDepth[LANE_COUNT];
+    // Área de trabalho da reordenação, reaproveitada entre ticks
+    Bucket scratch;
+    std::vector<int> order;
+};
+
+#endif // LANE_INDEX_H
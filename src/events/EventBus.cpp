@@ -0,0 +1,48 @@
+#include "EventBus.h"
+#include "../world/World.h"
+
+const char* gameEventName(GameEventType type) {
+    switch (type) {
+        case EVENT_GAME_STARTED:   return "GameStarted";
+        case EVENT_COLLIDED:       return "Collided";
+        case EVENT_PAUSED:         return "Paused";
+        case EVENT_RESUMED:        return "Resumed";
+        case EVENT_MENU_OPENED:    return "MenuOpened";
+        case EVENT_SPEED_LEVEL_UP: return "SpeedLevelUp";
+        default:                   return "?";
+    }
+}
+
+EventBus::EventBus() : dropped(0) {
+}
+
+EventBus::Queue* EventBus::subscribe(const std::string& name, size_t capacity, Semaphore* wake) {
+    Subscriber subscriber;
+    subscriber.name = name;
+    subscriber.queue.reset(new Queue(capacity));
+    subscriber.wake = wake;
+    subscribers.push_back(std::move(subscriber));
+    return subscribers.back().queue.get();
+}
+
+void EventBus::publish(const GameEvent& event) {
+    for (size_t i = 0; i < subscribers.size(); i++) {
+        if (!subscribers[i].queue->push(event)) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        } else if (subscribers[i].wake) {
+            subscribers[i].wake->post();
+        }
+    }
+}
+
+void EventBus::publish(GameEventType type, const World& world) {
+    GameEvent event;
+    event.type = type;
+    event.tick = world.getTickCount();
+    event.gameTime = world.getGameTime();
+    event.speedLevel = world.getSpeedLevel();
+    event.score = world.getScore().getCurrentScore();
+    event.highScore = world.getScore().getHighScore();
+    event.seed = world.getSeed();
+    publish(event);
+}
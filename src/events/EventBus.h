@@ -0,0 +1,52 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include "GameEvent.h"
+#include "../utils/MpscQueue.h"
+#include "../utils/Semaphore.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+class World;
+
+// Barramento de eventos da partida. Cada assinante tem sua própria fila
+// MPSC sem locks e a esvazia no seu ritmo (a cada quadro ou na sua thread);
+// publicar só copia o evento para as filas, sem chamar ninguém, então o
+// tick nunca espera por áudio, HUD ou telemetria. Com uma fila cheia o
+// evento é descartado para aquele assinante e contado em getDropped().
+// Assinantes com thread própria passam um Semaphore, sinalizado a cada
+// evento entregue, e dormem nele em vez de consultar a fila periodicamente;
+// o sinal só toca em trava quando o assinante está de fato dormindo.
+//
+// Os assinantes se registram na inicialização, antes da primeira publicação.
+class EventBus {
+public:
+    typedef MpscQueue<GameEvent> Queue;
+    static const size_t DEFAULT_CAPACITY = 256;
+
+    EventBus();
+
+    // wake (opcional) é sinalizado depois de cada evento posto na fila
+    Queue* subscribe(const std::string& name, size_t capacity = DEFAULT_CAPACITY, Semaphore* wake = NULL);
+
+    void publish(const GameEvent& event);
+    // Preenche o evento a partir do estado atual do World
+    void publish(GameEventType type, const World& world);
+
+    long long getDropped() const { return dropped.load(std::memory_order_relaxed); }
+    int getSubscriberCount() const { return (int)subscribers.size(); }
+
+private:
+    struct Subscriber {
+        std::string name;
+        std::unique_ptr<Queue> queue;
+        Semaphore* wake;
+    };
+
+    std::vector<Subscriber> subscribers;
+    std::atomic<long long> dropped;
+};
+
+#endif // EVENT_BUS_H
@@ -0,0 +1,31 @@
+#ifndef GAME_EVENT_H
+#define GAME_EVENT_H
+
+#include <cstdint>
+
+// Transições da partida publicadas no EventBus
+enum GameEventType {
+    EVENT_GAME_STARTED,     // Partida nova, repetida ou continuada
+    EVENT_COLLIDED,         // Colisão: fim da partida
+    EVENT_PAUSED,
+    EVENT_RESUMED,          // Saiu da pausa (ou do rewind) de volta ao jogo
+    EVENT_MENU_OPENED,      // Voltou ao menu principal
+    EVENT_SPEED_LEVEL_UP,
+    GAME_EVENT_TYPE_COUNT
+};
+
+// Evento com uma fotografia pequena do World no momento da publicação, para
+// que os assinantes não precisem ler o World (que continua mudando) depois
+struct GameEvent {
+    GameEventType type;
+    long long tick;
+    float gameTime;
+    int speedLevel;
+    int score;
+    int highScore;
+    uint64_t seed;
+};
+
+const char* gameEventName(GameEventType type);
+
+#endif // GAME_EVENT_H
@@ -0,0 +1,88 @@
+#include "Telemetry.h"
+#include <iostream>
+
+Telemetry::Telemetry() : queue(NULL), running(false) {
+    for (int i = 0; i < GAME_EVENT_TYPE_COUNT; i++) {
+        counts[i] = 0;
+    }
+    runs = 0;
+    survivalSum = 0.0;
+    bestSurvival = 0.0f;
+    bestScore = 0;
+    maxSpeedLevel = 0;
+}
+
+Telemetry::~Telemetry() {
+    stop();
+}
+
+void Telemetry::start(EventBus& bus, const std::string& logFile) {
+    if (running) return;
+    queue = bus.subscribe("telemetria", EventBus::DEFAULT_CAPACITY, &wake);
+
+    if (!logFile.empty()) {
+        log.open(logFile.c_str());
+        if (log.is_open()) {
+            log << "evento,tick,tempo,nivel,pontos,recorde,seed\n";
+        } else {
+            std::cerr << "Aviso: não foi possível gravar a telemetria em " << logFile << std::endl;
+        }
+    }
+
+    running = true;
+    worker = std::thread(&Telemetry::workerLoop, this);
+}
+
+void Telemetry::stop() {
+    if (!running) return;
+    running = false;
+    wake.post();
+    worker.join();
+    log.close();
+}
+
+void Telemetry::workerLoop() {
+    GameEvent event;
+    while (running) {
+        while (queue->pop(event)) {
+            handle(event);
+        }
+        wake.wait();
+    }
+    // Eventos publicados antes do stop()
+    while (queue->pop(event)) {
+        handle(event);
+    }
+    log.flush();
+}
+
+void Telemetry::handle(const GameEvent& event) {
+    counts[event.type]++;
+    if (event.speedLevel > maxSpeedLevel) maxSpeedLevel = event.speedLevel;
+
+    if (event.type == EVENT_COLLIDED) {
+        runs++;
+        survivalSum += event.gameTime;
+        if (event.gameTime > bestSurvival) bestSurvival = event.gameTime;
+        if (event.score > bestScore) bestScore = event.score;
+    }
+
+    if (log.is_open()) {
+        log << gameEventName(event.type) << ',' << event.tick << ',' << event.gameTime << ','
+            << event.speedLevel << ',' << event.score << ',' << event.highScore << ','
+            << event.seed << '\n';
+    }
+}
+
+void Telemetry::printSummary(const EventBus& bus) const {
+    std::cout << "=== Telemetria da sessão ===" << std::endl;
+    std::cout << "  Partidas: " << counts[EVENT_GAME_STARTED] << " iniciadas, " << runs << " encerradas por colisão" << std::endl;
+    if (runs > 0) {
+        std::cout << "  Sobrevivência média: " << survivalSum / runs << "s (melhor " << bestSurvival
+                  << "s, " << bestScore << " pontos)" << std::endl;
+    }
+    std::cout << "  Pausas: " << counts[EVENT_PAUSED] << ", nível de velocidade máximo: " << maxSpeedLevel << std::endl;
+    if (bus.getDropped() > 0) {
+        std::cout << "  Eventos descartados (fila cheia): " << bus.getDropped() << std::endl;
+    }
+}
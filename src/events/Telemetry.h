@@ -0,0 +1,43 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "EventBus.h"
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <thread>
+
+// Assinante de telemetria: esvazia sua fila numa thread própria, acumula
+// estatísticas da sessão e, opcionalmente, grava cada evento num CSV
+// (--telemetry arquivo). A escrita em disco nunca acontece na thread do jogo.
+class Telemetry {
+private:
+    EventBus::Queue* queue;
+    std::thread worker;
+    Semaphore wake;              // Sinalizado pelo EventBus e pelo stop()
+    std::atomic<bool> running;
+    std::ofstream log;
+
+    // Estatísticas (só a thread de telemetria escreve; lidas após stop())
+    long long counts[GAME_EVENT_TYPE_COUNT];
+    int runs;
+    double survivalSum;
+    float bestSurvival;
+    int bestScore;
+    int maxSpeedLevel;
+
+    void workerLoop();
+    void handle(const GameEvent& event);
+
+public:
+    Telemetry();
+    ~Telemetry();
+
+    // logFile vazio: só estatísticas
+    void start(EventBus& bus, const std::string& logFile);
+    // Esvazia o que restou na fila e encerra a thread
+    void stop();
+    void printSummary(const EventBus& bus) const;
+};
+
+#endif // TELEMETRY_H
@@ -0,0 +1,21 @@
+#include "InputQueue.h"
+
+void InputQueue::push(InputAction action) {
+    push(action, Clock::now());
+}
+
+void InputQueue::push(InputAction action, Clock::time_point arrival) {
+    TimedInput input;
+    input.action = action;
+    input.arrival = arrival;
+    pending.push_back(input);
+}
+
+bool InputQueue::popUntil(Clock::time_point tickStart, TimedInput& input) {
+    if (pending.empty() || pending.front().arrival > tickStart) {
+        return false;
+    }
+    input = pending.front();
+    pending.pop_front();
+    return true;
+}
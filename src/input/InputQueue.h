@@ -0,0 +1,35 @@
+#ifndef INPUT_QUEUE_H
+#define INPUT_QUEUE_H
+
+#include "../world/World.h"
+#include <chrono>
+#include <deque>
+
+// Comando do jogador com o instante em que chegou do teclado
+struct TimedInput {
+    InputAction action;
+    std::chrono::steady_clock::time_point arrival;
+};
+
+// Fila de entradas com timestamp. Os callbacks do GLUT só enfileiram; o
+// loop de simulação aplica cada entrada no primeiro tick que começa depois
+// da chegada dela, em vez de no tick seguinte ao quadro em que foi lida.
+class InputQueue {
+private:
+    std::deque<TimedInput> pending;
+
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    void push(InputAction action);
+    void push(InputAction action, Clock::time_point arrival);
+
+    // Retira a próxima entrada que chegou até tickStart (em ordem de chegada)
+    bool popUntil(Clock::time_point tickStart, TimedInput& input);
+
+    void clear() { pending.clear(); }
+    bool isEmpty() const { return pending.empty(); }
+    int size() const { return (int)pending.size(); }
+};
+
+#endif // INPUT_QUEUE_H
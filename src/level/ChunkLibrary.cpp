@@ -0,0 +1,270 @@
+#include "ChunkLibrary.h"
+#include "../obstacle/ObstacleArchetype.h"
+#include "../utils/Random.h"
+#include <algorithm>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <utility>
+
+// Pulo: velocidade 15 e gravidade -30 dão 1 s no ar, livre do obstáculo no meio
+const float ChunkLibrary::JUMP_CLEARANCE = 0.5f;
+// Deslize: dura 0.8 s
+const float ChunkLibrary::SLIDE_CLEARANCE = 0.4f;
+// Transição entre faixas: velocidade 8 (1/8 s por faixa)
+const float ChunkLibrary::LANE_CHANGE_TIME = 0.125f;
+const float ChunkLibrary::LANE_CHANGE_MARGIN = 0.1f;
+// Cobre pulo em andamento (0.5) + antecipação do próximo pulo (0.5) + duas faixas
+const float ChunkLibrary::STITCH_GAP = 1.5f;
+
+// Seed fixa: a biblioteca é a mesma em toda partida (replays dependem disso)
+static const uint64_t LIBRARY_SEED = 0x43484E4B;
+
+// Espaçamentos possíveis entre linhas (em intervalos de spawn) por nível
+static const int SPACING_COUNT = 3;
+static const float ROW_SPACINGS[ChunkLibrary::TIER_COUNT][SPACING_COUNT] = {
+    { 0.75f, 1.0f, 1.25f },
+    { 0.5f, 0.75f, 1.0f },
+    { 0.25f, 0.375f, 0.5f }
+};
+
+static const int MAX_ATTEMPTS_PER_CHUNK = 1000;
+static const float UNREACHABLE = 1e30f;
+
+ChunkLibrary::ChunkLibrary(const DifficultyParams& params)
+    : params(params), candidates(0), rejectedUnsolvable(0), rejectedTrivial(0) {
+    for (int tier = 0; tier < TIER_COUNT; tier++) {
+        generateTier(tier);
+    }
+    resolveEmptyTiers();
+}
+
+void ChunkLibrary::resolveEmptyTiers() {
+    // Uma mensagem por biblioteca, montada antes: as ferramentas geram
+    // bibliotecas em várias threads ao mesmo tempo
+    std::stringstream message;
+    for (int tier = 0; tier < TIER_COUNT; tier++) {
+        playableTier[tier] = -1;
+    }
+    for (int tier = 0; tier < TIER_COUNT; tier++) {
+        // Mais próximo primeiro; no empate, o mais fácil
+        for (int distance = 0; distance < TIER_COUNT && playableTier[tier] < 0; distance++) {
+            if (tier - distance >= 0 && !chunks[tier - distance].empty()) {
+                playableTier[tier] = tier - distance;
+            } else if (tier + distance < TIER_COUNT && !chunks[tier + distance].empty()) {
+                playableTier[tier] = tier + distance;
+            }
+        }
+        if (playableTier[tier] < 0) {
+            message << "Erro: nenhum trecho vencível gerado (intervalo de spawn " << params.spawnIntervalBase
+                    << ", inclinação " << params.spawnIntervalSlope << ", aumento " << params.speedIncreaseAmount
+                    << "); a fase não terá obstáculos\n";
+            break;
+        }
+        if (playableTier[tier] != tier) {
+            message << "Aviso: nenhum trecho vencível no nível de dificuldade " << tier
+                    << " após " << MAX_ATTEMPTS_PER_CHUNK * CHUNKS_PER_TIER
+                    << " tentativas; usando os trechos do nível " << playableTier[tier] << "\n";
+        }
+    }
+    if (!message.str().empty()) {
+        std::cerr << message.str() << std::flush;
+    }
+}
+
+int ChunkLibrary::tierForSpeedLevel(int speedLevel) {
+    return std::min(speedLevel / LEVELS_PER_TIER, TIER_COUNT - 1);
+}
+
+// Intervalo de spawn e multiplicador de velocidade num nível de velocidade
+// (as mesmas fórmulas de World::tick)
+static float spawnIntervalAt(const DifficultyParams& params, int speedLevel) {
+    return params.spawnIntervalBase + speedLevel * params.speedIncreaseAmount * params.spawnIntervalSlope;
+}
+
+static float speedAt(const DifficultyParams& params, int speedLevel) {
+    return 1.0f + speedLevel * params.speedIncreaseAmount;
+}
+
+float ChunkLibrary::verificationInterval(const DifficultyParams& params, int tier) {
+    int firstLevel = tier * LEVELS_PER_TIER;
+    // O último nível vale daí para cima; ver os limites em ChunkLibrary.h
+    int lastLevel = tier < TIER_COUNT - 1 ? firstLevel + LEVELS_PER_TIER - 1 : firstLevel;
+    
+    // O intervalo é linear no nível: o menor está numa das pontas
+    float interval = std::min(spawnIntervalAt(params, firstLevel), spawnIntervalAt(params, lastLevel));
+    
+    // Uma subida de velocidade (para qualquer nível do trecho, ou para o
+    // seguinte) encurta na mesma proporção o tempo entre as linhas em trânsito
+    float compression = 1.0f;
+    for (int level = std::max(1, firstLevel); level <= lastLevel + 1; level++) {
+        compression = std::min(compression, speedAt(params, level - 1) / speedAt(params, level));
+    }
+    return interval * compression;
+}
+
+void ChunkLibrary::generateTier(int tier) {
+    Random random(Random::deriveSeed(LIBRARY_SEED, tier));
+    
+    float spawnInterval = verificationInterval(params, tier);
+    float doubleChance = std::min(1.0f, params.doubleSpawnChance * (1.0f + 0.5f * tier));
+    // Paredes (as três faixas ocupadas) só a partir do segundo nível
+    float wallChance = params.doubleSpawnChance * 0.5f * tier;
+    
+    std::vector<Chunk>& tierChunks = chunks[tier];
+    int attempts = 0;
+    while ((int)tierChunks.size() < CHUNKS_PER_TIER && attempts < CHUNKS_PER_TIER * MAX_ATTEMPTS_PER_CHUNK) {
+        attempts++;
+        candidates++;
+        
+        Chunk chunk;
+        chunk.tier = tier;
+        
+        int rowCount = 3 + random.nextInt(2 + tier);
+        float offset = 0.0f;
+        for (int r = 0; r < rowCount; r++) {
+            if (r > 0) {
+                offset += ROW_SPACINGS[tier][random.nextInt(SPACING_COUNT)];
+            }
+            
+            ChunkRow row;
+            row.offset = offset;
+            for (int lane = 0; lane < ChunkRow::LANE_COUNT; lane++) {
+                row.lanes[lane] = OBSTACLE_TYPE_COUNT;
+            }
+            
+            // Um a três obstáculos, em faixas diferentes
+            int count = random.nextFloat() < doubleChance ? 2 : 1;
+            if (count == 2 && random.nextFloat() < wallChance) {
+                count = 3;
+            }
+            for (int i = 0; i < count; i++) {
+                int lane;
+                do {
+                    lane = random.nextInt(ChunkRow::LANE_COUNT);
+                } while (!row.isEmpty(lane));
+                row.lanes[lane] = (uint8_t)random.nextInt(OBSTACLE_TYPE_COUNT);
+            }
+            chunk.rows.push_back(row);
+        }
+        chunk.length = offset + STITCH_GAP / spawnInterval;
+        
+        if (!isSolvable(chunk.rows, spawnInterval)) {
+            rejectedUnsolvable++;
+            continue;
+        }
+        if (isTrivial(chunk.rows)) {
+            rejectedTrivial++;
+            continue;
+        }
+        tierChunks.push_back(chunk);
+    }
+}
+
+bool ChunkLibrary::isSolvable(const std::vector<ChunkRow>& rows, float spawnInterval) {
+    // freeAt[lane]: menor instante em que o jogador, nessa faixa ao passar
+    // pela linha atual, fica livre para pular/deslizar de novo. Estados com
+    // freeAt maior na mesma faixa são dominados e não precisam ser guardados.
+    float freeAt[ChunkRow::LANE_COUNT];
+    for (int lane = 0; lane < ChunkRow::LANE_COUNT; lane++) {
+        freeAt[lane] = -UNREACHABLE; // Começo do trecho: qualquer faixa, livre
+    }
+    
+    float previousTime = -UNREACHABLE;
+    for (const ChunkRow& row : rows) {
+        float time = row.offset * spawnInterval;
+        float next[ChunkRow::LANE_COUNT];
+        bool reachable = false;
+        
+        for (int to = 0; to < ChunkRow::LANE_COUNT; to++) {
+            next[to] = UNREACHABLE;
+            
+            for (int from = 0; from < ChunkRow::LANE_COUNT; from++) {
+                if (freeAt[from] >= UNREACHABLE) continue;
+                
+                // Trocar de faixa entre uma linha e outra
+                float laneTime = std::abs(to - from) * LANE_CHANGE_TIME + LANE_CHANGE_MARGIN;
+                if (from != to && laneTime > time - previousTime) continue;
+                
+                float free = freeAt[from];
+                if (!row.isEmpty(to)) {
+                    switch (getArchetype((ObstacleType)row.lanes[to]).clearAction) {
+                        case CLEAR_JUMP:
+                            if (free > time - JUMP_CLEARANCE) continue;
+                            free = time + JUMP_CLEARANCE;
+                            break;
+                        case CLEAR_SLIDE:
+                            if (free > time - SLIDE_CLEARANCE) continue;
+                            free = time + SLIDE_CLEARANCE;
+                            break;
+                        default:
+                            continue;
+                    }
+                }
+                next[to] = std::min(next[to], free);
+                reachable = true;
+            }
+        }
+        
+        if (!reachable) return false;
+        for (int lane = 0; lane < ChunkRow::LANE_COUNT; lane++) {
+            freeAt[lane] = next[lane];
+        }
+        previousTime = time;
+    }
+    return true;
+}
+
+bool ChunkLibrary::isTrivial(const std::vector<ChunkRow>& rows) {
+    for (int lane = 0; lane < ChunkRow::LANE_COUNT; lane++) {
+        bool alwaysEmpty = true;
+        for (const ChunkRow& row : rows) {
+            if (!row.isEmpty(lane)) {
+                alwaysEmpty = false;
+                break;
+            }
+        }
+        if (alwaysEmpty) return true;
+    }
+    return false;
+}
+
+bool ChunkLibrary::sameLibrary(const DifficultyParams& a, const DifficultyParams& b) {
+    return a.spawnIntervalBase == b.spawnIntervalBase &&
+           a.spawnIntervalSlope == b.spawnIntervalSlope &&
+           a.speedIncreaseAmount == b.speedIncreaseAmount &&
+           a.doubleSpawnChance == b.doubleSpawnChance;
+}
+
+std::shared_ptr<const ChunkLibrary> ChunkLibrary::get(const DifficultyParams& params) {
+    typedef std::shared_future<std::shared_ptr<const ChunkLibrary> > Pending;
+    
+    // Cache por parâmetros que afetam a geração. A trava só protege a lista;
+    // a geração (e a espera por ela) acontece fora dela.
+    static std::mutex cacheMutex;
+    static std::vector<std::pair<DifficultyParams, Pending> > cache;
+    
+    std::promise<std::shared_ptr<const ChunkLibrary> > promise;
+    Pending pending;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        for (const auto& entry : cache) {
+            if (sameLibrary(entry.first, params)) {
+                pending = entry.second;
+                break;
+            }
+        }
+        if (!pending.valid()) {
+            cache.push_back(std::make_pair(params, Pending(promise.get_future())));
+        }
+    }
+    if (pending.valid()) {
+        return pending.get();
+    }
+    
+    std::shared_ptr<const ChunkLibrary> library(new ChunkLibrary(params));
+    promise.set_value(library);
+    return library;
+}
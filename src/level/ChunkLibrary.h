@@ -0,0 +1,107 @@
+#ifndef CHUNK_LIBRARY_H
+#define CHUNK_LIBRARY_H
+
+#include "../obstacle/Obstacle.h"
+#include "../world/DifficultyParams.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Uma linha de obstáculos de um trecho: até um obstáculo por faixa
+struct ChunkRow {
+    static const int LANE_COUNT = 3;
+    
+    float offset;                 // Início da linha, em intervalos de spawn desde o começo do trecho
+    uint8_t lanes[LANE_COUNT];    // ObstacleType de cada faixa (OBSTACLE_TYPE_COUNT = vazia)
+    
+    bool isEmpty(int lane) const { return lanes[lane] == OBSTACLE_TYPE_COUNT; }
+};
+
+// Trecho de fase: sequência de linhas já verificada como vencível
+struct Chunk {
+    std::vector<ChunkRow> rows;
+    float length;                 // Fim do trecho (última linha + folga), em intervalos de spawn
+    int tier;
+};
+
+// Biblioteca de trechos gerada e verificada antes do jogo começar.
+//
+// Cada trecho candidato é sorteado com os parâmetros do nível de dificuldade
+// e só entra na biblioteca se uma busca sobre os estados do jogador (faixa e
+// momento em que ele fica livre para pular/deslizar de novo) encontrar um
+// caminho por todas as linhas - e se ele não puder ser vencido parado em uma
+// faixa sem fazer nada. Durante o jogo os trechos são apenas encadeados; a
+// folga no fim de cada um garante que qualquer estado final chega a qualquer
+// estado inicial do próximo.
+//
+// A verificação é feita em segundos, no instante em que cada linha chega ao
+// jogador. Com todos os obstáculos na mesma velocidade, esse intervalo não
+// depende da velocidade nem da taxa de ticks - exceto quando a velocidade
+// sobe: as linhas já na tela mantêm a distância entre si e passam a chegar
+// mais juntas. Por isso cada nível é verificado com o menor intervalo de
+// spawn dos seus níveis de velocidade, comprimido pela maior subida de
+// velocidade possível com linhas em trânsito (verificationInterval).
+//
+// Limites do modelo: o último nível de dificuldade vale para todas as
+// velocidades acima dele e é verificado no seu primeiro nível de velocidade,
+// o que só é conservador se o intervalo de spawn não diminui com a
+// velocidade (spawnIntervalSlope >= 0). As folgas de pulo e deslize são as
+// da física do jogador e ignoram o tamanho dos obstáculos (que passam mais
+// rápido quanto maior a velocidade, o que só facilita).
+class ChunkLibrary {
+public:
+    static const int TIER_COUNT = 3;
+    static const int LEVELS_PER_TIER = 2;   // Níveis de velocidade por nível de dificuldade
+    static const int CHUNKS_PER_TIER = 64;
+    
+    // Modelo do jogador usado na verificação (derivado da física de Player)
+    static const float JUMP_CLEARANCE;      // Pulo ocupa [t - 0.5, t + 0.5] para passar em t
+    static const float SLIDE_CLEARANCE;     // Deslize ocupa [t - 0.4, t + 0.4]
+    static const float LANE_CHANGE_TIME;    // Tempo para trocar uma faixa
+    static const float LANE_CHANGE_MARGIN;  // Folga para não estar trocando de faixa na passagem
+    static const float STITCH_GAP;          // Folga (s) entre o fim de um trecho e o próximo
+    
+    // Biblioteca para os parâmetros (gerada uma vez e compartilhada). A
+    // geração roda fora da trava: parâmetros diferentes geram em paralelo
+    // e quem pede uma biblioteca em geração espera só por ela.
+    static std::shared_ptr<const ChunkLibrary> get(const DifficultyParams& params);
+    // true se as duas configurações geram a mesma biblioteca
+    static bool sameLibrary(const DifficultyParams& a, const DifficultyParams& b);
+    
+    // Nível de dificuldade para um nível de velocidade
+    static int tierForSpeedLevel(int speedLevel);
+    // Nível de onde vêm os trechos de tier: ele mesmo ou, se a geração não
+    // encontrou trechos para ele, o nível não vazio mais próximo (-1 se a
+    // biblioteca inteira ficou vazia)
+    int getPlayableTier(int tier) const { return playableTier[tier]; }
+    bool isPlayable() const { return playableTier[0] >= 0; }
+    // Intervalo (s) usado para verificar e encadear os trechos do nível
+    static float verificationInterval(const DifficultyParams& params, int tier);
+    
+    // Verifica se a sequência de linhas é vencível com o intervalo dado (s)
+    static bool isSolvable(const std::vector<ChunkRow>& rows, float spawnInterval);
+    // Verifica se dá para vencer parado em alguma faixa, sem pular nem deslizar
+    static bool isTrivial(const std::vector<ChunkRow>& rows);
+    
+    const DifficultyParams& getParams() const { return params; }
+    const std::vector<Chunk>& getChunks(int tier) const { return chunks[tier]; }
+    // Quantos candidatos foram sorteados e quantos descartados, por motivo
+    long long getCandidates() const { return candidates; }
+    long long getRejectedUnsolvable() const { return rejectedUnsolvable; }
+    long long getRejectedTrivial() const { return rejectedTrivial; }
+    
+private:
+    DifficultyParams params;
+    std::vector<Chunk> chunks[TIER_COUNT];
+    int playableTier[TIER_COUNT];
+    long long candidates;
+    long long rejectedUnsolvable;
+    long long rejectedTrivial;
+    
+    explicit ChunkLibrary(const DifficultyParams& params);
+    void generateTier(int tier);
+    // Preenche playableTier e avisa (stderr) dos níveis que ficaram vazios
+    void resolveEmptyTiers();
+};
+
+#endif // CHUNK_LIBRARY_H
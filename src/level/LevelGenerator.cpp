@@ -0,0 +1,97 @@
+#include "LevelGenerator.h"
+#include "../collision/LaneIndex.h"
+#include "../utils/Hash.h"
+
+const float LevelGenerator::FIRST_CHUNK_DELAY = 1.0f;
+
+// As faixas dos trechos são as mesmas da broadphase
+static_assert(ChunkRow::LANE_COUNT == LaneIndex::LANE_COUNT, "ChunkRow e LaneIndex precisam ter as mesmas faixas");
+
+LevelGenerator::LevelGenerator()
+    : tier(0), chunkIndex(-1), nextRow(0), elapsed(0.0f), startDelay(FIRST_CHUNK_DELAY), droppedObstacles(0) {
+}
+
+void LevelGenerator::reset(const DifficultyParams& params) {
+    // A biblioteca só é trocada se os parâmetros mudarem: recomeçar uma
+    // partida não passa pelo cache compartilhado
+    if (!library || !ChunkLibrary::sameLibrary(library->getParams(), params)) {
+        library = ChunkLibrary::get(params);
+    }
+    tier = 0;
+    chunkIndex = -1;
+    nextRow = 0;
+    elapsed = 0.0f;
+    startDelay = FIRST_CHUNK_DELAY;
+}
+
+void LevelGenerator::update(float deltaTime, float spawnInterval, int speedLevel,
+                            Random& random, ObstacleSystem& obstacles, float spawnZ) {
+    elapsed += deltaTime / spawnInterval;
+    
+    while (true) {
+        if (chunkIndex < 0) {
+            if (elapsed < startDelay) return;
+            elapsed -= startDelay;
+            startDelay = 0.0f;
+            
+            // Próximo trecho, do nível de dificuldade da velocidade atual
+            // (ou do mais próximo com trechos; a biblioteca já avisou)
+            int playable = library->getPlayableTier(ChunkLibrary::tierForSpeedLevel(speedLevel));
+            if (playable < 0) return;
+            tier = playable;
+            const std::vector<Chunk>& chunks = library->getChunks(tier);
+            chunkIndex = random.nextInt((int)chunks.size());
+            nextRow = 0;
+        }
+        
+        const Chunk& chunk = library->getChunks(tier)[chunkIndex];
+        while (nextRow < (int)chunk.rows.size() && elapsed >= chunk.rows[nextRow].offset) {
+            spawnRow(chunk.rows[nextRow], obstacles, spawnZ);
+            nextRow++;
+        }
+        
+        // Trecho termina depois da folga que segue a última linha
+        if (nextRow < (int)chunk.rows.size() || elapsed < chunk.length) return;
+        elapsed -= chunk.length;
+        chunkIndex = -1;
+    }
+}
+
+void LevelGenerator::spawnRow(const ChunkRow& row, ObstacleSystem& obstacles, float spawnZ) {
+    for (int lane = 0; lane < ChunkRow::LANE_COUNT; lane++) {
+        if (row.isEmpty(lane)) continue;
+        if (obstacles.spawn((ObstacleType)row.lanes[lane], LaneIndex::laneCenterX(lane), spawnZ) < 0) {
+            droppedObstacles++;
+        }
+    }
+}
+
+uint32_t LevelGenerator::hashState(uint32_t hash) const {
+    hash = Hash::combine(hash, tier);
+    hash = Hash::combine(hash, chunkIndex);
+    hash = Hash::combine(hash, nextRow);
+    hash = Hash::combine(hash, elapsed);
+    hash = Hash::combine(hash, startDelay);
+    return hash;
+}
+
+void LevelGenerator::saveState(State& state) const {
+    state.tier = tier;
+    state.chunkIndex = chunkIndex;
+    state.nextRow = nextRow;
+    state.elapsed = elapsed;
+    state.startDelay = startDelay;
+}
+
+bool LevelGenerator::loadState(const State& state) {
+    if (state.tier < 0 || state.tier >= ChunkLibrary::TIER_COUNT) return false;
+    const std::vector<Chunk>& chunks = library->getChunks(state.tier);
+    if (state.chunkIndex < -1 || state.chunkIndex >= (int)chunks.size()) return false;
+    if (state.chunkIndex >= 0 && (state.nextRow < 0 || state.nextRow > (int)chunks[state.chunkIndex].rows.size())) return false;
+    tier = state.tier;
+    chunkIndex = state.chunkIndex;
+    nextRow = state.nextRow;
+    elapsed = state.elapsed;
+    startDelay = state.startDelay;
+    return true;
+}
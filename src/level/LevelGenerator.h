@@ -0,0 +1,63 @@
+#ifndef LEVEL_GENERATOR_H
+#define LEVEL_GENERATOR_H
+
+#include "ChunkLibrary.h"
+#include "../obstacle/ObstacleSystem.h"
+#include "../utils/Random.h"
+#include <cstdint>
+#include <memory>
+
+// Gera a fase durante o jogo encadeando trechos já verificados da
+// ChunkLibrary, escolhidos pelo nível de dificuldade. Nenhum sorteio é
+// descartado durante o jogo: só se escolhe o próximo trecho e se cria
+// cada linha quando chega a hora dela.
+class LevelGenerator {
+public:
+    // Posição na fase (a biblioteca vem dos parâmetros, não é copiada)
+    struct State {
+        int32_t tier;
+        int32_t chunkIndex;
+        int32_t nextRow;
+        float elapsed;
+        float startDelay;
+    };
+    
+private:
+    std::shared_ptr<const ChunkLibrary> library;
+    int tier;
+    int chunkIndex;      // -1 = esperando o início do próximo trecho
+    int nextRow;
+    float elapsed;       // Intervalos de spawn desde o início do trecho atual
+    float startDelay;    // Espera antes do primeiro trecho da partida
+    long long droppedObstacles; // Obstáculos não criados por falta de espaço no pool
+    
+    void spawnRow(const ChunkRow& row, ObstacleSystem& obstacles, float spawnZ);
+    
+public:
+    // Espera antes da primeira linha (o mesmo primeiro spawn de antes)
+    static const float FIRST_CHUNK_DELAY;
+    
+    LevelGenerator();
+    
+    // Nova partida com a biblioteca dos parâmetros
+    void reset(const DifficultyParams& params);
+    
+    // Avança o tempo e cria as linhas que chegaram na hora
+    void update(float deltaTime, float spawnInterval, int speedLevel,
+                Random& random, ObstacleSystem& obstacles, float spawnZ);
+    
+    const ChunkLibrary& getLibrary() const { return *library; }
+    int getTier() const { return tier; }
+    // Obstáculos de linhas que não couberam no pool (maxObstacles pequeno
+    // demais para os trechos), somados desde a criação - não só na partida
+    long long getDroppedObstacles() const { return droppedObstacles; }
+    
+    // Combina o estado ao hash (checksum de replay)
+    uint32_t hashState(uint32_t hash) const;
+    
+    void saveState(State& state) const;
+    // Depois de reset(params) com os mesmos parâmetros; falha se o trecho não existir
+    bool loadState(const State& state);
+};
+
+#endif // LEVEL_GENERATOR_H
@@ -1,5 +1,8 @@
 #include "Menu.h"
+#include "../viewport/Viewport.h"
 #include <cmath>
+#include <iomanip>
+#include <sstream>
 
 Menu::Menu() {
     currentState = MENU;
@@ -30,15 +33,8 @@ void Menu::renderMainMenu() {
     // Limpar o buffer de cor primeiro
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     
-    // Configurar para renderização 2D
-    glMatrixMode(GL_PROJECTION);
-    glPushMatrix();
-    glLoadIdentity();
-    glOrtho(0, 800, 0, 600, -1, 1);
-    
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
-    glLoadIdentity();
+    // Configurar para renderização 2D (projeção em cache do Viewport)
+    Viewport::begin2D();
     
     glDisable(GL_DEPTH_TEST);
     glDisable(GL_LIGHTING);
@@ -54,27 +50,31 @@ void Menu::renderMainMenu() {
     
     glEnable(GL_DEPTH_TEST);
     
-    glPopMatrix();
-    glMatrixMode(GL_PROJECTION);
-    glPopMatrix();
-    glMatrixMode(GL_MODELVIEW);
+    Viewport::end2D();
 }
 
 void Menu::renderSpaceBackground() {
+    // Limites visíveis (o fundo cobre a janela inteira, não só a área de layout)
+    float left = Viewport::getLeft();
+    float right = Viewport::getRight();
+    float bottom = Viewport::getBottom();
+    float top = Viewport::getTop();
+    float middle = (bottom + top) / 2.0f;
+    
     // Gradiente espacial escuro
     glBegin(GL_QUADS);
     // Topo - azul escuro espacial
     glColor3f(0.05f, 0.05f, 0.15f);
-    glVertex2f(0, 600);
-    glVertex2f(800, 600);
+    glVertex2f(left, top);
+    glVertex2f(right, top);
     // Meio - roxo escuro
     glColor3f(0.1f, 0.05f, 0.2f);
-    glVertex2f(800, 300);
-    glVertex2f(0, 300);
+    glVertex2f(right, middle);
+    glVertex2f(left, middle);
     // Base - preto profundo
     glColor3f(0.02f, 0.02f, 0.08f);
-    glVertex2f(800, 0);
-    glVertex2f(0, 0);
+    glVertex2f(right, bottom);
+    glVertex2f(left, bottom);
     glEnd();
     
     // Campo de estrelas dinâmico
@@ -88,10 +88,16 @@ void Menu::renderStarField() {
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     
+    // Espalhar as estrelas por toda a área visível
+    float left = Viewport::getLeft();
+    float bottom = Viewport::getBottom();
+    float scaleX = (Viewport::getRight() - left) / Viewport::VIRTUAL_WIDTH;
+    float scaleY = (Viewport::getTop() - bottom) / Viewport::VIRTUAL_HEIGHT;
+    
     // Estrelas grandes brilhantes
     for (int i = 0; i < 50; i++) {
-        float x = (i * 73 + 123) % 800;
-        float y = (i * 47 + 200) % 600;
+        float x = left + ((i * 73 + 123) % 800) * scaleX;
+        float y = bottom + ((i * 47 + 200) % 600) * scaleY;
         float brightness = 0.7f + 0.3f * sin(i * 0.5f);
         
         glColor4f(1.0f, 1.0f, 1.0f, brightness);
@@ -103,8 +109,8 @@ void Menu::renderStarField() {
     
     // Estrelas pequenas
     for (int i = 0; i < 150; i++) {
-        float x = (i * 127 + 50) % 800;
-        float y = (i * 83 + 100) % 600;
+        float x = left + ((i * 127 + 50) % 800) * scaleX;
+        float y = bottom + ((i * 83 + 100) % 600) * scaleY;
         float brightness = 0.3f + 0.2f * sin(i * 0.7f);
         
         glColor4f(0.8f, 0.9f, 1.0f, brightness);
@@ -319,15 +325,8 @@ void Menu::renderStylizedInstructions() {
 }
 
 void Menu::renderPauseMenu() {
-    // Configurar para renderização 2D
-    glMatrixMode(GL_PROJECTION);
-    glPushMatrix();
-    glLoadIdentity();
-    glOrtho(0, 800, 0, 600, -1, 1);
-    
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
-    glLoadIdentity();
+    // Configurar para renderização 2D (projeção em cache do Viewport)
+    Viewport::begin2D();
     
     glDisable(GL_DEPTH_TEST);
     glDisable(GL_LIGHTING);
@@ -337,10 +336,10 @@ void Menu::renderPauseMenu() {
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glColor4f(0.0f, 0.0f, 0.0f, 0.8f);
     glBegin(GL_QUADS);
-    glVertex2f(0, 0);
-    glVertex2f(800, 0);
-    glVertex2f(800, 600);
-    glVertex2f(0, 600);
+    glVertex2f(Viewport::getLeft(), Viewport::getBottom());
+    glVertex2f(Viewport::getRight(), Viewport::getBottom());
+    glVertex2f(Viewport::getRight(), Viewport::getTop());
+    glVertex2f(Viewport::getLeft(), Viewport::getTop());
     glEnd();
     
     // Painel de pausa moderno
@@ -403,14 +402,77 @@ void Menu::renderPauseMenu() {
     
     // Instruções
     glColor3f(0.6f, 0.8f, 1.0f);
-    renderTextCentered(240, "↑↓ Navegar  |  ENTER Selecionar  |  ESC Continuar", GLUT_BITMAP_HELVETICA_12);
+    renderTextCentered(240, "↑↓ Navegar  |  ENTER Selecionar  |  ESC Continuar  |  S Salvar", GLUT_BITMAP_HELVETICA_12);
+    
+    glEnable(GL_DEPTH_TEST);
+    
+    Viewport::end2D();
+}
+
+void Menu::renderRewindOverlay(float secondsBack, float windowSeconds) {
+    Viewport::begin2D();
+    
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_LIGHTING);
+    
+    // Faixa translúcida no topo
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glColor4f(0.0f, 0.05f, 0.15f, 0.75f);
+    glBegin(GL_QUADS);
+    glVertex2f(Viewport::getLeft(), 500);
+    glVertex2f(Viewport::getRight(), 500);
+    glVertex2f(Viewport::getRight(), 580);
+    glVertex2f(Viewport::getLeft(), 580);
+    glEnd();
+    
+    // Barra da janela de rewind: a posição atual em relação à colisão
+    float fraction = windowSeconds > 0.0f ? 1.0f - secondsBack / windowSeconds : 1.0f;
+    glColor4f(0.3f, 0.3f, 0.4f, 0.9f);
+    glBegin(GL_QUADS);
+    glVertex2f(200, 512);
+    glVertex2f(600, 512);
+    glVertex2f(600, 518);
+    glVertex2f(200, 518);
+    glEnd();
+    glColor4f(0.3f, 0.8f, 1.0f, 1.0f);
+    glBegin(GL_QUADS);
+    glVertex2f(200, 510);
+    glVertex2f(200 + 400 * fraction, 510);
+    glVertex2f(200 + 400 * fraction, 520);
+    glVertex2f(200, 520);
+    glEnd();
+    glDisable(GL_BLEND);
+    
+    std::stringstream title;
+    title << "REWIND  -" << std::fixed << std::setprecision(2) << secondsBack << "s";
+    glColor3f(0.3f, 0.8f, 1.0f);
+    renderTextCentered(555, title.str(), GLUT_BITMAP_HELVETICA_18);
+    glColor3f(0.8f, 0.8f, 0.9f);
+    renderTextCentered(530, "← → Voltar/Avançar  |  ENTER Continuar daqui  |  ESC Game over", GLUT_BITMAP_HELVETICA_12);
+    
+    glEnable(GL_DEPTH_TEST);
+    
+    Viewport::end2D();
+}
+
+void Menu::renderSpeedBanner(int speedLevel, float fade) {
+    Viewport::begin2D();
     
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_LIGHTING);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    
+    std::stringstream text;
+    text << "VELOCIDADE NÍVEL " << speedLevel << "!";
+    glColor4f(1.0f, 0.8f, 0.2f, fade);
+    renderTextCentered(420, text.str(), GLUT_BITMAP_TIMES_ROMAN_24);
+    
+    glDisable(GL_BLEND);
     glEnable(GL_DEPTH_TEST);
     
-    glPopMatrix();
-    glMatrixMode(GL_PROJECTION);
-    glPopMatrix();
-    glMatrixMode(GL_MODELVIEW);
+    Viewport::end2D();
 }
 
 void Menu::renderGameOverMenu() {
@@ -462,7 +524,7 @@ void Menu::renderText(float x, float y, const std::string& text, void* font) {
 
 void Menu::renderTextCentered(float y, const std::string& text, void* font) {
     int width = getTextWidth(text, font);
-    float x = (800 - width) / 2.0f;
+    float x = Viewport::getCenterX() - Viewport::pixelsToUnits((float)width) / 2.0f;
     renderText(x, y, text, font);
 }
 
@@ -484,7 +546,7 @@ void Menu::renderTextWithShadow(float x, float y, const std::string& text, void*
 
 void Menu::renderTextCenteredWithShadow(float y, const std::string& text, void* font) {
     int width = getTextWidth(text, font);
-    float x = (800 - width) / 2.0f;
+    float x = Viewport::getCenterX() - Viewport::pixelsToUnits((float)width) / 2.0f;
     renderTextWithShadow(x, y, text, font);
 }
 
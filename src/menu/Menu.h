@@ -8,7 +8,8 @@ enum GameState {
     MENU,
     PLAYING,
     GAME_OVER,
-    PAUSED
+    PAUSED,
+    REWINDING     // Voltando no tempo depois de uma colisão
 };
 
 class Menu {
@@ -26,6 +27,10 @@ public:
     void renderInstructions();
     void renderGameOverMenu();
     void renderPauseMenu();
+    // Faixa do modo rewind (segundos antes da colisão e tamanho da janela)
+    void renderRewindOverlay(float secondsBack, float windowSeconds);
+    // Aviso de aumento de velocidade (fade de 1 a 0)
+    void renderSpeedBanner(int speedLevel, float fade);
     
     // Controle de estado
     void setState(GameState state);
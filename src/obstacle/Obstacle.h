@@ -2,48 +2,36 @@
 #define OBSTACLE_H
 
 #include "../utils/Vector3.h"
-#include <GL/glut.h>
 
 enum ObstacleType {
     STATIC,
     MOVING_VERTICAL,
     ROCKET,
-    HIGH_OBSTACLE
+    HIGH_OBSTACLE,
+    OBSTACLE_TYPE_COUNT
 };
 
-class Obstacle {
-private:
+// Visão (cópia) de um obstáculo vivo. O estado real fica em arrays
+// contíguos no ObstacleSystem; esta estrutura serve para colisão e debug.
+struct Obstacle {
     Vector3 position;
+    Vector3 previousPosition; // Posição no início do tick (colisão contínua)
     Vector3 size;
     ObstacleType type;
-    float speed;
-    float oscillationAmplitude;
-    float oscillationSpeed;
-    float time;
-    float originalY;
-    bool active;
     
-public:
     Obstacle();
     Obstacle(Vector3 pos, Vector3 sz, ObstacleType t);
-    ~Obstacle();
-    
-    void update(float deltaTime);
-    void render() const;
-    void reset(Vector3 pos, Vector3 sz, ObstacleType t);
+    Obstacle(Vector3 pos, Vector3 previousPos, Vector3 sz, ObstacleType t);
     
     // Getters
     Vector3 getPosition() const { return position; }
+    Vector3 getPreviousPosition() const { return previousPosition; }
     Vector3 getSize() const { return size; }
-    bool isActive() const { return active; }
     ObstacleType getType() const { return type; }
     
     // Para detecção de colisão
     Vector3 getMin() const;
     Vector3 getMax() const;
-    
-    void setActive(bool state) { active = state; }
-    void moveZ(float deltaZ) { position.z += deltaZ; }
 };
 
-#endif 
\ No newline at end of file
+#endif
@@ -0,0 +1,71 @@
+#ifndef OBSTACLE_ARCHETYPE_H
+#define OBSTACLE_ARCHETYPE_H
+
+#include "Obstacle.h"
+
+// Regra de colisão aplicada quando a caixa do jogador toca a do obstáculo
+enum CollisionRule {
+    RULE_SOLID,        // Sempre colide (só dá para desviar ou pular, se couber)
+    RULE_SLIDE_UNDER   // Não colide se o jogador deslizar por baixo
+};
+
+// Como o jogador passa pelo obstáculo sem trocar de faixa
+// (usado pela verificação de solubilidade dos trechos de fase)
+enum ClearAction {
+    CLEAR_JUMP,   // Pulando por cima
+    CLEAR_SLIDE,  // Deslizando por baixo
+    CLEAR_DODGE   // Não dá: só desviando para outra faixa
+};
+
+// Modelo usado na renderização
+enum ObstacleMesh {
+    MESH_ALIEN,
+    MESH_ROCKET
+};
+
+// Material (cor principal) usado na renderização
+enum ObstacleMaterial {
+    MATERIAL_ALIEN_GREEN,
+    MATERIAL_ALIEN_ORANGE,
+    MATERIAL_ROCKET_RED,
+    MATERIAL_ALIEN_PURPLE
+};
+
+// Tudo o que define um tipo de obstáculo. Spawn, atualização, colisão e
+// renderização consultam esta tabela; um tipo novo é só uma linha a mais.
+struct ObstacleArchetype {
+    float sizeX, sizeY, sizeZ;
+    float spawnY;                // Altura do centro no spawn
+    float oscillationSpeed;      // Frequência da oscilação vertical (rad/s)
+    float oscillationAmplitude;  // Amplitude da oscilação vertical
+    CollisionRule collisionRule;
+    ClearAction clearAction;
+    ObstacleMesh mesh;
+    ObstacleMaterial material;
+};
+
+// Oscilação padrão, escalada por tipo
+constexpr float BASE_OSCILLATION_SPEED = 3.0f;
+constexpr float BASE_OSCILLATION_AMPLITUDE = 2.0f;
+
+// Indexada por ObstacleType
+constexpr ObstacleArchetype OBSTACLE_ARCHETYPES[OBSTACLE_TYPE_COUNT] = {
+    // STATIC: alien parado no chão
+    { 1.0f, 2.0f, 1.0f, 2.0f, 0.0f, 0.0f,
+      RULE_SOLID, CLEAR_JUMP, MESH_ALIEN, MATERIAL_ALIEN_GREEN },
+    // MOVING_VERTICAL: alien que sobe e desce (alto demais para pular com segurança)
+    { 1.0f, 2.0f, 1.0f, 2.0f, BASE_OSCILLATION_SPEED, BASE_OSCILLATION_AMPLITUDE,
+      RULE_SOLID, CLEAR_DODGE, MESH_ALIEN, MATERIAL_ALIEN_ORANGE },
+    // ROCKET: foguete muito alto - impossível de pular
+    { 1.2f, 4.0f, 3.0f, 2.0f, BASE_OSCILLATION_SPEED * 0.5f, BASE_OSCILLATION_AMPLITUDE * 0.3f,
+      RULE_SOLID, CLEAR_DODGE, MESH_ROCKET, MATERIAL_ROCKET_RED },
+    // HIGH_OBSTACLE: elevado do chão para permitir deslize embaixo
+    { 1.0f, 2.5f, 1.0f, 3.0f, BASE_OSCILLATION_SPEED * 0.3f, BASE_OSCILLATION_AMPLITUDE * 0.2f,
+      RULE_SLIDE_UNDER, CLEAR_SLIDE, MESH_ALIEN, MATERIAL_ALIEN_PURPLE }
+};
+
+constexpr const ObstacleArchetype& getArchetype(ObstacleType type) {
+    return OBSTACLE_ARCHETYPES[type];
+}
+
+#endif // OBSTACLE_ARCHETYPE_H
@@ -0,0 +1,195 @@
+#include "ObstacleKernel.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define OBSTACLE_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+// Redução de faixa: x = k*pi + r, com pi dividido em duas partes
+// (Cody-Waite) para que k*PI_HI seja exato em float
+static const float INV_PI = 0.318309886183790671538f;
+static const float PI_HI = 3.140625f;
+static const float PI_LO = 9.67653589793e-4f;
+
+// sin(r) = r + r^3 * (S3 + r^2 * (S5 + r^2 * (S7 + r^2 * S9))), r em [-pi/2, pi/2]
+// (coeficientes minimax, erro de aproximação < 5e-9 nesse intervalo)
+static const float S3 = -1.66666571e-1f;
+static const float S5 = 8.33301729e-3f;
+static const float S7 = -1.98066152e-4f;
+static const float S9 = 2.60005486e-6f;
+
+std::atomic<KernelBackend> ObstacleKernel::backend(KERNEL_AUTO);
+
+float ObstacleKernel::sinApprox(float x) {
+    // nearbyint arredonda para o par mais próximo, como cvtps2dq
+    int32_t k = (int32_t)std::nearbyint(x * INV_PI);
+    float kf = (float)k;
+    float r = (x - kf * PI_HI) - kf * PI_LO;
+    float r2 = r * r;
+    float p = S9;
+    p = p * r2 + S7;
+    p = p * r2 + S5;
+    p = p * r2 + S3;
+    float s = r + (r * r2) * p;
+    
+    // sin(x) = (-1)^k * sin(r): troca o bit de sinal quando k é ímpar
+    uint32_t bits;
+    std::memcpy(&bits, &s, sizeof(bits));
+    bits ^= (uint32_t)k << 31;
+    std::memcpy(&s, &bits, sizeof(s));
+    return s;
+}
+
+static void updateScalar(float* time, float* posY, float* posZ,
+                         const float* originalY, const float* frequency, const float* amplitude,
+                         int begin, int count, float deltaTime, float deltaZ) {
+    for (int i = begin; i < count; i++) {
+        time[i] += deltaTime;
+        posY[i] = originalY[i] + ObstacleKernel::sinApprox(time[i] * frequency[i]) * amplitude[i];
+        posZ[i] += deltaZ;
+    }
+}
+
+#ifdef OBSTACLE_KERNEL_X86
+
+__attribute__((target("sse2")))
+static int updateSSE2(float* time, float* posY, float* posZ,
+                      const float* originalY, const float* frequency, const float* amplitude,
+                      int count, float deltaTime, float deltaZ) {
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 dz = _mm_set1_ps(deltaZ);
+    const __m128 invPi = _mm_set1_ps(INV_PI);
+    const __m128 piHi = _mm_set1_ps(PI_HI);
+    const __m128 piLo = _mm_set1_ps(PI_LO);
+    
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 t = _mm_add_ps(_mm_loadu_ps(time + i), dt);
+        _mm_storeu_ps(time + i, t);
+        
+        __m128 x = _mm_mul_ps(t, _mm_loadu_ps(frequency + i));
+        __m128i k = _mm_cvtps_epi32(_mm_mul_ps(x, invPi));
+        __m128 kf = _mm_cvtepi32_ps(k);
+        __m128 r = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(kf, piHi)), _mm_mul_ps(kf, piLo));
+        __m128 r2 = _mm_mul_ps(r, r);
+        __m128 p = _mm_set1_ps(S9);
+        p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(S7));
+        p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(S5));
+        p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(S3));
+        __m128 s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), p));
+        s = _mm_xor_ps(s, _mm_castsi128_ps(_mm_slli_epi32(k, 31)));
+        
+        __m128 y = _mm_add_ps(_mm_loadu_ps(originalY + i), _mm_mul_ps(s, _mm_loadu_ps(amplitude + i)));
+        _mm_storeu_ps(posY + i, y);
+        _mm_storeu_ps(posZ + i, _mm_add_ps(_mm_loadu_ps(posZ + i), dz));
+    }
+    return i;
+}
+
+// Sem FMA de propósito: mul + add separados mantêm o resultado igual ao escalar
+__attribute__((target("avx2")))
+static int updateAVX2(float* time, float* posY, float* posZ,
+                      const float* originalY, const float* frequency, const float* amplitude,
+                      int count, float deltaTime, float deltaZ) {
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 dz = _mm256_set1_ps(deltaZ);
+    const __m256 invPi = _mm256_set1_ps(INV_PI);
+    const __m256 piHi = _mm256_set1_ps(PI_HI);
+    const __m256 piLo = _mm256_set1_ps(PI_LO);
+    
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 t = _mm256_add_ps(_mm256_loadu_ps(time + i), dt);
+        _mm256_storeu_ps(time + i, t);
+        
+        __m256 x = _mm256_mul_ps(t, _mm256_loadu_ps(frequency + i));
+        __m256i k = _mm256_cvtps_epi32(_mm256_mul_ps(x, invPi));
+        __m256 kf = _mm256_cvtepi32_ps(k);
+        __m256 r = _mm256_sub_ps(_mm256_sub_ps(x, _mm256_mul_ps(kf, piHi)), _mm256_mul_ps(kf, piLo));
+        __m256 r2 = _mm256_mul_ps(r, r);
+        __m256 p = _mm256_set1_ps(S9);
+        p = _mm256_add_ps(_mm256_mul_ps(p, r2), _mm256_set1_ps(S7));
+        p = _mm256_add_ps(_mm256_mul_ps(p, r2), _mm256_set1_ps(S5));
+        p = _mm256_add_ps(_mm256_mul_ps(p, r2), _mm256_set1_ps(S3));
+        __m256 s = _mm256_add_ps(r, _mm256_mul_ps(_mm256_mul_ps(r, r2), p));
+        s = _mm256_xor_ps(s, _mm256_castsi256_ps(_mm256_slli_epi32(k, 31)));
+        
+        __m256 y = _mm256_add_ps(_mm256_loadu_ps(originalY + i), _mm256_mul_ps(s, _mm256_loadu_ps(amplitude + i)));
+        _mm256_storeu_ps(posY + i, y);
+        _mm256_storeu_ps(posZ + i, _mm256_add_ps(_mm256_loadu_ps(posZ + i), dz));
+    }
+    return i;
+}
+
+#endif // OBSTACLE_KERNEL_X86
+
+void ObstacleKernel::update(float* time, float* posY, float* posZ,
+                            const float* originalY, const float* frequency, const float* amplitude,
+                            int count, float deltaTime, float deltaZ) {
+    int done = 0;
+    
+#ifdef OBSTACLE_KERNEL_X86
+    switch (getBackend()) {
+        case KERNEL_AVX2:
+            done = updateAVX2(time, posY, posZ, originalY, frequency, amplitude, count, deltaTime, deltaZ);
+            break;
+        case KERNEL_SSE2:
+            done = updateSSE2(time, posY, posZ, originalY, frequency, amplitude, count, deltaTime, deltaZ);
+            break;
+        default:
+            break;
+    }
+#endif
+    
+    // Resto que não preencheu um vetor inteiro (ou tudo, no backend escalar)
+    updateScalar(time, posY, posZ, originalY, frequency, amplitude, done, count, deltaTime, deltaZ);
+}
+
+bool ObstacleKernel::isSupported(KernelBackend candidate) {
+    switch (candidate) {
+        case KERNEL_SCALAR:
+        case KERNEL_AUTO:
+            return true;
+#ifdef OBSTACLE_KERNEL_X86
+        case KERNEL_SSE2:
+            return __builtin_cpu_supports("sse2");
+        case KERNEL_AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+void ObstacleKernel::setBackend(KernelBackend newBackend) {
+    backend.store(isSupported(newBackend) ? newBackend : KERNEL_SCALAR, std::memory_order_relaxed);
+}
+
+KernelBackend ObstacleKernel::getBackend() {
+    KernelBackend current = backend.load(std::memory_order_relaxed);
+    return current == KERNEL_AUTO ? getDetectedBackend() : current;
+}
+
+static KernelBackend detectBackend() {
+    if (ObstacleKernel::isSupported(KERNEL_AVX2)) return KERNEL_AVX2;
+    if (ObstacleKernel::isSupported(KERNEL_SSE2)) return KERNEL_SSE2;
+    return KERNEL_SCALAR;
+}
+
+KernelBackend ObstacleKernel::getDetectedBackend() {
+    // Static local: inicializado uma vez, de forma segura entre threads
+    static const KernelBackend detected = detectBackend();
+    return detected;
+}
+
+const char* ObstacleKernel::getBackendName(KernelBackend candidate) {
+    switch (candidate) {
+        case KERNEL_SCALAR: return "escalar";
+        case KERNEL_SSE2: return "SSE2";
+        case KERNEL_AVX2: return "AVX2";
+        default: return "auto";
+    }
+}
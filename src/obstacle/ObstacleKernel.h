@@ -0,0 +1,43 @@
+#ifndef OBSTACLE_KERNEL_H
+#define OBSTACLE_KERNEL_H
+
+#include <atomic>
+
+// Kernel em lote da atualização dos obstáculos (arrays do ObstacleSystem).
+//
+// Para cada obstáculo: time += dt; y = originalY + sin(time * freq) * amp;
+// z += deltaZ. O seno é uma aproximação polinomial (erro ~1e-7 para os
+// ângulos do jogo) calculada com as mesmas operações, na mesma ordem, nas
+// versões escalar, SSE2 e AVX2 - o resultado é idêntico bit a bit em
+// qualquer backend, o que mantém replays e checksums válidos entre máquinas.
+enum KernelBackend {
+    KERNEL_SCALAR,
+    KERNEL_SSE2,
+    KERNEL_AVX2,
+    KERNEL_AUTO
+};
+
+class ObstacleKernel {
+private:
+    // Lido pelas threads do ThreadPool (autopilot, tuner) a cada tick
+    static std::atomic<KernelBackend> backend;
+    
+public:
+    // Aproximação escalar de sin(x) usada por todos os backends
+    static float sinApprox(float x);
+    
+    // Atualiza count obstáculos de uma vez
+    static void update(float* time, float* posY, float* posZ,
+                       const float* originalY, const float* frequency, const float* amplitude,
+                       int count, float deltaTime, float deltaZ);
+    
+    // Backend usado (KERNEL_AUTO detecta a CPU em tempo de execução)
+    static void setBackend(KernelBackend newBackend);
+    static KernelBackend getBackend();
+    // Melhor backend suportado pela CPU (detectado uma única vez)
+    static KernelBackend getDetectedBackend();
+    static bool isSupported(KernelBackend candidate);
+    static const char* getBackendName(KernelBackend candidate);
+};
+
+#endif // OBSTACLE_KERNEL_H
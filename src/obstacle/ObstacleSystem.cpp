@@ -0,0 +1,206 @@
+#include "ObstacleSystem.h"
+#include "ObstacleArchetype.h"
+#include "ObstacleKernel.h"
+#include "../utils/Hash.h"
+#include <cstring>
+
+ObstacleSystem::ObstacleSystem(int capacity) : capacity(0), count(0) {
+    setCapacity(capacity);
+}
+
+void ObstacleSystem::setCapacity(int newCapacity) {
+    capacity = newCapacity;
+    
+    posX.assign(capacity, 0.0f); posY.assign(capacity, 0.0f); posZ.assign(capacity, 0.0f);
+    prevX.assign(capacity, 0.0f); prevY.assign(capacity, 0.0f); prevZ.assign(capacity, 0.0f);
+    sizeX.assign(capacity, 0.0f); sizeY.assign(capacity, 0.0f); sizeZ.assign(capacity, 0.0f);
+    time.assign(capacity, 0.0f);
+    originalY.assign(capacity, 0.0f);
+    oscFrequency.assign(capacity, 0.0f);
+    oscAmplitude.assign(capacity, 0.0f);
+    type.assign(capacity, 0);
+    handleOf.assign(capacity, -1);
+    indexOf.assign(capacity, -1);
+    
+    clear();
+}
+
+void ObstacleSystem::clear() {
+    count = 0;
+    
+    // Lista livre com os handles em ordem (o topo é o handle 0)
+    freeHandles.clear();
+    for (int handle = capacity - 1; handle >= 0; handle--) {
+        freeHandles.push_back(handle);
+        indexOf[handle] = -1;
+    }
+}
+
+int ObstacleSystem::spawn(const Vector3& position, const Vector3& size, ObstacleType obstacleType) {
+    if (freeHandles.empty()) return -1;
+    
+    int handle = freeHandles.back();
+    freeHandles.pop_back();
+    
+    int index = count++;
+    handleOf[index] = handle;
+    indexOf[handle] = index;
+    
+    posX[index] = prevX[index] = position.x;
+    posY[index] = prevY[index] = position.y;
+    posZ[index] = prevZ[index] = position.z;
+    sizeX[index] = size.x;
+    sizeY[index] = size.y;
+    sizeZ[index] = size.z;
+    time[index] = 0.0f;
+    originalY[index] = position.y;
+    type[index] = (uint8_t)obstacleType;
+    
+    // Comportamento de oscilação do tipo
+    const ObstacleArchetype& archetype = getArchetype(obstacleType);
+    oscFrequency[index] = archetype.oscillationSpeed;
+    oscAmplitude[index] = archetype.oscillationAmplitude;
+    
+    return handle;
+}
+
+int ObstacleSystem::spawn(ObstacleType obstacleType, float x, float z) {
+    const ObstacleArchetype& archetype = getArchetype(obstacleType);
+    return spawn(Vector3(x, archetype.spawnY, z),
+                 Vector3(archetype.sizeX, archetype.sizeY, archetype.sizeZ), obstacleType);
+}
+
+void ObstacleSystem::despawn(int handle) {
+    if (handle < 0 || handle >= capacity || indexOf[handle] < 0) return;
+    removeAt(indexOf[handle]);
+}
+
+// Remove o índice denso movendo o último obstáculo vivo para o lugar dele
+void ObstacleSystem::removeAt(int index) {
+    int handle = handleOf[index];
+    int last = --count;
+    
+    if (index != last) {
+        posX[index] = posX[last]; posY[index] = posY[last]; posZ[index] = posZ[last];
+        prevX[index] = prevX[last]; prevY[index] = prevY[last]; prevZ[index] = prevZ[last];
+        sizeX[index] = sizeX[last]; sizeY[index] = sizeY[last]; sizeZ[index] = sizeZ[last];
+        time[index] = time[last];
+        originalY[index] = originalY[last];
+        oscFrequency[index] = oscFrequency[last];
+        oscAmplitude[index] = oscAmplitude[last];
+        type[index] = type[last];
+        handleOf[index] = handleOf[last];
+        indexOf[handleOf[index]] = index;
+    }
+    
+    indexOf[handle] = -1;
+    freeHandles.push_back(handle);
+}
+
+void ObstacleSystem::update(float deltaTime, float deltaZ, float despawnZ) {
+    // Tempo, oscilação e movimento em z de todos os vivos em lote (SIMD)
+    ObstacleKernel::update(time.data(), posY.data(), posZ.data(),
+                           originalY.data(), oscFrequency.data(), oscAmplitude.data(),
+                           count, deltaTime, deltaZ);
+    
+    // Remover os que saíram da tela (percorrendo de trás para frente,
+    // o swap-remove só traz para o índice atual elementos já verificados)
+    for (int i = count - 1; i >= 0; i--) {
+        if (posZ[i] > despawnZ) {
+            removeAt(i);
+        }
+    }
+}
+
+void ObstacleSystem::storePreviousState() {
+    for (int i = 0; i < count; i++) {
+        prevX[i] = posX[i];
+        prevY[i] = posY[i];
+        prevZ[i] = posZ[i];
+    }
+}
+
+Obstacle ObstacleSystem::get(int index) const {
+    return Obstacle(getPosition(index), Vector3(prevX[index], prevY[index], prevZ[index]),
+                    Vector3(sizeX[index], sizeY[index], sizeZ[index]), getType(index));
+}
+
+Vector3 ObstacleSystem::getRenderPosition(int index, float alpha) const {
+    return Vector3(prevX[index] + (posX[index] - prevX[index]) * alpha,
+                   prevY[index] + (posY[index] - prevY[index]) * alpha,
+                   prevZ[index] + (posZ[index] - prevZ[index]) * alpha);
+}
+
+uint32_t ObstacleSystem::hashState(uint32_t hash) const {
+    hash = Hash::combine(hash, count);
+    for (int i = 0; i < count; i++) {
+        hash = Hash::combine(hash, posX[i]);
+        hash = Hash::combine(hash, posY[i]);
+        hash = Hash::combine(hash, posZ[i]);
+        hash = Hash::combine(hash, type[i]);
+        hash = Hash::combine(hash, time[i]);
+    }
+    return hash;
+}
+
+bool ObstacleSystem::saveState(State& state) const {
+    if (capacity > MAX_STATE_CAPACITY) return false;
+    
+    state.capacity = capacity;
+    state.count = count;
+    state.freeCount = (int32_t)freeHandles.size();
+    size_t bytes = count * sizeof(float);
+    memcpy(state.posX, posX.data(), bytes); memcpy(state.posY, posY.data(), bytes); memcpy(state.posZ, posZ.data(), bytes);
+    memcpy(state.prevX, prevX.data(), bytes); memcpy(state.prevY, prevY.data(), bytes); memcpy(state.prevZ, prevZ.data(), bytes);
+    memcpy(state.sizeX, sizeX.data(), bytes); memcpy(state.sizeY, sizeY.data(), bytes); memcpy(state.sizeZ, sizeZ.data(), bytes);
+    memcpy(state.time, time.data(), bytes);
+    memcpy(state.originalY, originalY.data(), bytes);
+    memcpy(state.oscFrequency, oscFrequency.data(), bytes);
+    memcpy(state.oscAmplitude, oscAmplitude.data(), bytes);
+    memcpy(state.type, type.data(), count);
+    memcpy(state.handleOf, handleOf.data(), count * sizeof(int32_t));
+    memcpy(state.freeHandles, freeHandles.data(), freeHandles.size() * sizeof(int32_t));
+    return true;
+}
+
+bool ObstacleSystem::loadState(const State& state) {
+    // Validar tudo antes de tocar no pool: um estado rejeitado o deixa intacto
+    if (state.capacity < 0 || state.capacity > MAX_STATE_CAPACITY) return false;
+    if (state.count < 0 || state.freeCount < 0 || state.count + state.freeCount != state.capacity) return false;
+    
+    for (int index = 0; index < state.count; index++) {
+        if (state.type[index] >= OBSTACLE_TYPE_COUNT) return false;
+    }
+    
+    // Cada handle aparece exatamente uma vez entre os vivos e a lista livre
+    // (count + freeCount == capacity, então basta não haver repetidos)
+    bool seen[MAX_STATE_CAPACITY] = {};
+    for (int i = 0; i < state.capacity; i++) {
+        int handle = i < state.count ? state.handleOf[i] : state.freeHandles[i - state.count];
+        if (handle < 0 || handle >= state.capacity || seen[handle]) return false;
+        seen[handle] = true;
+    }
+    
+    if (capacity != state.capacity) {
+        setCapacity(state.capacity);
+    }
+    count = state.count;
+    size_t bytes = count * sizeof(float);
+    memcpy(posX.data(), state.posX, bytes); memcpy(posY.data(), state.posY, bytes); memcpy(posZ.data(), state.posZ, bytes);
+    memcpy(prevX.data(), state.prevX, bytes); memcpy(prevY.data(), state.prevY, bytes); memcpy(prevZ.data(), state.prevZ, bytes);
+    memcpy(sizeX.data(), state.sizeX, bytes); memcpy(sizeY.data(), state.sizeY, bytes); memcpy(sizeZ.data(), state.sizeZ, bytes);
+    memcpy(time.data(), state.time, bytes);
+    memcpy(originalY.data(), state.originalY, bytes);
+    memcpy(oscFrequency.data(), state.oscFrequency, bytes);
+    memcpy(oscAmplitude.data(), state.oscAmplitude, bytes);
+    memcpy(type.data(), state.type, count);
+    freeHandles.assign(state.freeHandles, state.freeHandles + state.freeCount);
+    
+    // Reconstruir o índice handle -> denso
+    indexOf.assign(capacity, -1);
+    for (int index = 0; index < count; index++) {
+        handleOf[index] = state.handleOf[index];
+        indexOf[handleOf[index]] = index;
+    }
+    return true;
+}
@@ -0,0 +1,102 @@
+#ifndef OBSTACLE_SYSTEM_H
+#define OBSTACLE_SYSTEM_H
+
+#include "Obstacle.h"
+#include <cstdint>
+#include <vector>
+
+// Sistema de obstáculos em estrutura de arrays (SoA).
+//
+// Cada campo fica em um array contíguo próprio e os obstáculos vivos ficam
+// compactados em [0, size()): remover um obstáculo move o último para o
+// lugar dele (swap-remove). Cada obstáculo também tem um handle estável,
+// tirado de uma lista livre em O(1) no spawn e devolvido no despawn.
+// Atualização, colisão e renderização percorrem apenas os vivos.
+class ObstacleSystem {
+public:
+    // Maior capacidade que cabe em um State (snapshots de tamanho fixo)
+    static const int MAX_STATE_CAPACITY = 64;
+    
+    // Cópia POD de todo o pool, inclusive handles e lista livre
+    struct State {
+        int32_t capacity;
+        int32_t count;
+        int32_t freeCount;
+        float posX[MAX_STATE_CAPACITY], posY[MAX_STATE_CAPACITY], posZ[MAX_STATE_CAPACITY];
+        float prevX[MAX_STATE_CAPACITY], prevY[MAX_STATE_CAPACITY], prevZ[MAX_STATE_CAPACITY];
+        float sizeX[MAX_STATE_CAPACITY], sizeY[MAX_STATE_CAPACITY], sizeZ[MAX_STATE_CAPACITY];
+        float time[MAX_STATE_CAPACITY], originalY[MAX_STATE_CAPACITY];
+        float oscFrequency[MAX_STATE_CAPACITY], oscAmplitude[MAX_STATE_CAPACITY];
+        uint8_t type[MAX_STATE_CAPACITY];
+        int32_t handleOf[MAX_STATE_CAPACITY];
+        int32_t freeHandles[MAX_STATE_CAPACITY];
+    };
+    
+private:
+    int capacity;
+    int count;
+    
+    // Estado atual
+    std::vector<float> posX, posY, posZ;
+    // Estado no tick anterior (interpolação da renderização)
+    std::vector<float> prevX, prevY, prevZ;
+    std::vector<float> sizeX, sizeY, sizeZ;
+    // Oscilação vertical: y = originalY + sin(time * frequência) * amplitude
+    std::vector<float> time, originalY, oscFrequency, oscAmplitude;
+    std::vector<uint8_t> type;
+    
+    // Handles estáveis
+    std::vector<int> handleOf;   // índice denso -> handle
+    std::vector<int> indexOf;    // handle -> índice denso (-1 = livre)
+    std::vector<int> freeHandles;
+    
+    void removeAt(int index);
+    
+public:
+    ObstacleSystem(int capacity = 15);
+    
+    // Remove todos os obstáculos e ajusta a capacidade
+    void clear();
+    void setCapacity(int newCapacity);
+    
+    // Cria um obstáculo; retorna o handle ou -1 se o pool estiver cheio
+    int spawn(const Vector3& position, const Vector3& size, ObstacleType obstacleType);
+    // Cria um obstáculo com o tamanho e a altura do arquétipo do tipo
+    int spawn(ObstacleType obstacleType, float x, float z);
+    // Remove pelo handle
+    void despawn(int handle);
+    
+    // Avança a oscilação, move todos em z e remove os que passaram de despawnZ
+    void update(float deltaTime, float deltaZ, float despawnZ);
+    
+    // Guarda o estado atual antes de avançar um tick de simulação
+    void storePreviousState();
+    
+    // Renderiza os obstáculos vivos (interpolados)
+    void render(float alpha = 1.0f) const;
+    
+    // Acesso por índice denso (0 <= index < size())
+    int size() const { return count; }
+    int getCapacity() const { return capacity; }
+    Obstacle get(int index) const;
+    Vector3 getPosition(int index) const { return Vector3(posX[index], posY[index], posZ[index]); }
+    Vector3 getRenderPosition(int index, float alpha) const;
+    ObstacleType getType(int index) const { return (ObstacleType)type[index]; }
+    // Centro e amplitude da oscilação vertical (y fica em baseY ± amplitude)
+    float getBaseY(int index) const { return originalY[index]; }
+    float getOscillationAmplitude(int index) const { return oscAmplitude[index]; }
+    int getHandle(int index) const { return handleOf[index]; }
+    int getIndex(int handle) const { return indexOf[handle]; }
+    
+    // Combina o estado da simulação ao hash (checksum de replay)
+    uint32_t hashState(uint32_t hash) const;
+    
+    // Salva/restaura o pool; falham se a capacidade passar de MAX_STATE_CAPACITY
+    // (o que não foi usado em state fica como estava - zerado, se veio zerado).
+    // loadState valida tipos e handles antes de mudar o pool: se falhar, o
+    // pool fica como estava.
+    bool saveState(State& state) const;
+    bool loadState(const State& state);
+};
+
+#endif // OBSTACLE_SYSTEM_H
@@ -1,5 +1,5 @@
 #include "Player.h"
-#include "../lighting/Lighting.h"
+#include "../utils/Hash.h"
 #include <cmath>
 
 // Definição das constantes
@@ -10,9 +10,11 @@ const float Player::GROUND_Y = 0.975f;
 const float Player::SLIDE_DURATION = 0.8f;
 const float Player::SLIDE_HEIGHT = 0.3f;
 const float Player::LANE_TRANSITION_SPEED = 8.0f;
+const float Player::JUMP_DURATION = 2.0f * JUMP_SPEED / -GRAVITY;
 
 Player::Player() {
     position = Vector3(0.0f, GROUND_Y, 0.0f);
+    previousPosition = position;
     velocity = Vector3(0.0f, 0.0f, 0.0f);
     currentLane = 1; // Começa no centro
     targetLane = 1;  // Inicialmente igual ao current
@@ -26,238 +28,80 @@ Player::Player() {
     size = 1.0f;
 }
 
-Player::~Player() {
+float Player::jumpCurve(float t) {
+    return GROUND_Y + JUMP_SPEED * t + 0.5f * GRAVITY * t * t;
+}
+
+float Player::slideCurve(float t) {
+    // Abaixa de uma vez e volta à altura normal em linha reta
+    return GROUND_Y - SLIDE_HEIGHT * (1.0f - t / SLIDE_DURATION);
+}
+
+PlayerPose Player::predict(float t) const {
+    PlayerPose pose;
+    pose.position = position;
+    pose.jumping = false;
+    pose.sliding = false;
+    
+    // Transição entre faixas (smoothstep)
+    float targetX = (targetLane - 1) * LANE_WIDTH;
+    pose.position.x = targetX;
+    if (currentLane != targetLane) {
+        float transitionDuration = 1.0f / laneTransitionSpeed;
+        float u = (laneTransitionTime + t) / transitionDuration;
+        if (u < 1.0f) {
+            float currentX = (currentLane - 1) * LANE_WIDTH;
+            float smoothT = u * u * (3.0f - 2.0f * u);
+            pose.position.x = currentX + (targetX - currentX) * smoothT;
+        }
+    }
+    
+    // Pulo e deslize; terminados, o jogador está no chão
+    pose.position.y = GROUND_Y;
+    if (isJumping && jumpTime + t < JUMP_DURATION) {
+        pose.position.y = jumpCurve(jumpTime + t);
+        pose.jumping = true;
+    } else if (isSliding && slideTime + t < SLIDE_DURATION) {
+        pose.position.y = slideCurve(slideTime + t);
+        pose.sliding = true;
+    }
+    return pose;
 }
 
 void Player::update(float deltaTime) {
-    // Atualizar transição suave entre faixas com interpolação suave
+    PlayerPose pose = predict(deltaTime);
+    position = pose.position;
+    
+    // Avançar os tempos de cada movimento (a pose já é a do fim do tick)
     if (currentLane != targetLane) {
         laneTransitionTime += deltaTime;
-        
-        float currentX = (currentLane - 1) * LANE_WIDTH;
-        float targetX = (targetLane - 1) * LANE_WIDTH;
-        
-        // Usar interpolação suave (smoothstep) para transição mais natural
-        float transitionDuration = 1.0f / laneTransitionSpeed;
-        float t = laneTransitionTime / transitionDuration;
-        
-        if (t >= 1.0f) {
-            // Transição completa
-            position.x = targetX;
+        if (laneTransitionTime / (1.0f / laneTransitionSpeed) >= 1.0f) {
             currentLane = targetLane;
             laneTransitionTime = 0.0f;
-        } else {
-            // Aplicar curva de suavização (smoothstep)
-            float smoothT = t * t * (3.0f - 2.0f * t);
-            position.x = currentX + (targetX - currentX) * smoothT;
         }
     } else {
-        // Garantir que está exatamente na posição da faixa quando não está em transição
-        float targetX = (currentLane - 1) * LANE_WIDTH;
-        position.x = targetX;
         laneTransitionTime = 0.0f;
     }
     
-    // Atualizar física do pulo
     if (isJumping) {
         jumpTime += deltaTime;
-        velocity.y += GRAVITY * deltaTime;
-        position.y += velocity.y * deltaTime;
-        
-        // Verificar se tocou o chão
-        if (position.y <= GROUND_Y) {
-            position.y = GROUND_Y;
+        if (!pose.jumping) {
             isJumping = false;
-            velocity.y = 0.0f;
             jumpTime = 0.0f;
         }
     }
+    // Velocidade vertical: derivada da parábola (usada no checksum)
+    velocity.y = isJumping ? JUMP_SPEED + GRAVITY * jumpTime : 0.0f;
     
-    // Atualizar física do deslize
     if (isSliding) {
         slideTime += deltaTime;
-        
-        // Altura do deslize diminui gradualmente
-        float slideProgress = slideTime / SLIDE_DURATION;
-        float slideHeight = SLIDE_HEIGHT * (1.0f - slideProgress);
-        position.y = GROUND_Y - slideHeight;
-        
-        // Verificar se o deslize terminou
-        if (slideTime >= SLIDE_DURATION) {
-            position.y = GROUND_Y;
+        if (!pose.sliding) {
             isSliding = false;
             slideTime = 0.0f;
         }
     }
 }
 
-void Player::render() {
-    glPushMatrix();
-    // Posicionar o jogador
-    glTranslatef(position.x, position.y, position.z);
-
-    // Escala baseada no estado (deslize torna o jogador mais baixo e largo)
-    float scaleX = size;
-    float scaleY = size;
-    float scaleZ = size;
-    bool sliding = isSliding;
-    if (sliding) {
-        scaleX *= 1.5f;  // Mais largo
-        scaleY *= 0.5f;  // Mais baixo
-        scaleZ *= 1.2f;  // Um pouco mais longo
-    }
-    glScalef(scaleX, scaleY, scaleZ);
-
-    // Animação baseada no tempo global (corrida)
-    float t = glutGet(GLUT_ELAPSED_TIME) / 1000.0f;
-    drawCharacter(t, sliding);
-
-    glPopMatrix();
-}
-
-// Desenha o boneco segmentado e animado
-void Player::drawCharacter(float t, bool sliding) {
-    // Cores
-    float skin[3]   = {1.0f, 0.85f, 0.6f};
-    float shirt[3]  = {0.15f, 0.45f, 1.0f}; // Azul mais vivo
-    float pants[3]  = {0.13f, 0.13f, 0.25f};
-    float shoes[3]  = {0.95f, 0.25f, 0.25f}; // Tênis vermelhos
-    float accent[3] = {1.0f, 0.8f, 0.2f};    // Cinto amarelo
-    float gloves[3] = {0.95f, 0.95f, 0.95f}; // Luvas brancas
-    float visor[3]  = {0.4f, 0.85f, 1.0f};   // Visor azul claro
-
-    // Proporções "heróicas"
-    float bodyH = 1.0f, bodyW = 0.38f, bodyD = 0.26f;
-    float headR = 0.23f;
-    float armL = 0.62f, armR = 0.11f;
-    float legL = 0.95f, legR = 0.14f;
-    float footL = 0.22f, footH = 0.09f;
-
-    // Animação de corrida (ângulos)
-    float runSpeed = sliding ? 0.0f : 7.0f;
-    float legSwing = sliding ? 0.0f : 45.0f * sinf(t * runSpeed);
-    float legSwing2 = sliding ? 0.0f : 45.0f * sinf(t * runSpeed + 3.1415f);
-    float armSwing = sliding ? 0.0f : 38.0f * sinf(t * runSpeed + 3.1415f);
-    float armSwing2 = sliding ? 0.0f : 38.0f * sinf(t * runSpeed);
-    float bodyLean = sliding ? 0.0f : 12.0f * sinf(t * runSpeed * 0.5f);
-
-    // Tronco
-    glPushMatrix();
-    glRotatef(bodyLean, 1, 0, 0);
-    glColor3fv(shirt);
-    glScalef(bodyW, bodyH, bodyD);
-    glutSolidCube(1.0f);
-    glPopMatrix();
-
-    // Cinto
-    glPushMatrix();
-    glTranslatef(0.0f, -bodyH*0.23f, 0.0f);
-    glColor3fv(accent);
-    glScalef(bodyW*1.05f, bodyH*0.13f, bodyD*1.05f);
-    glutSolidCube(1.0f);
-    glPopMatrix();
-
-    // Cabeça
-    glPushMatrix();
-    glTranslatef(0.0f, bodyH/2 + headR*0.93f, 0.0f);
-    glColor3fv(skin);
-    glutSolidSphere(headR, 18, 14);
-    // Visor futurista
-    glPushMatrix();
-    glTranslatef(0.0f, 0.03f, headR*0.7f);
-    glColor3fv(visor);
-    glScalef(0.7f, 0.38f, 0.18f);
-    glutSolidSphere(0.5f, 12, 8);
-    glPopMatrix();
-    glPopMatrix();
-
-    // Braço esquerdo
-    glPushMatrix();
-    glTranslatef(-(bodyW/2 + armR*0.7f), bodyH/2 - armR*0.1f, 0.0f);
-    glRotatef(armSwing, 1, 0, 0);
-    // Ombro
-    glColor3fv(shirt);
-    glutSolidSphere(armR*1.1f, 10, 8);
-    // Braço
-    glTranslatef(0.0f, -armL/2, 0.0f);
-    glPushMatrix();
-    glColor3fv(shirt);
-    glScalef(armR, armL, armR);
-    glutSolidCube(1.0f);
-    glPopMatrix();
-    // Luva
-    glTranslatef(0.0f, -armL/2 - armR*0.13f, 0.0f);
-    glColor3fv(gloves);
-    glutSolidSphere(armR*0.8f, 10, 8);
-    glPopMatrix();
-
-    // Braço direito
-    glPushMatrix();
-    glTranslatef((bodyW/2 + armR*0.7f), bodyH/2 - armR*0.1f, 0.0f);
-    glRotatef(armSwing2, 1, 0, 0);
-    // Ombro
-    glColor3fv(shirt);
-    glutSolidSphere(armR*1.1f, 10, 8);
-    // Braço
-    glTranslatef(0.0f, -armL/2, 0.0f);
-    glPushMatrix();
-    glColor3fv(shirt);
-    glScalef(armR, armL, armR);
-    glutSolidCube(1.0f);
-    glPopMatrix();
-    // Luva
-    glTranslatef(0.0f, -armL/2 - armR*0.13f, 0.0f);
-    glColor3fv(gloves);
-    glutSolidSphere(armR*0.8f, 10, 8);
-    glPopMatrix();
-
-    // Perna esquerda
-    glPushMatrix();
-    glTranslatef(-bodyW*0.22f, -bodyH/2, 0.0f);
-    glRotatef(legSwing, 1, 0, 0);
-    // Quadril
-    glColor3fv(pants);
-    glutSolidSphere(legR*1.1f, 10, 8);
-    // Perna
-    glTranslatef(0.0f, -legL/2, 0.0f);
-    glPushMatrix();
-    glColor3fv(pants);
-    glScalef(legR, legL, legR);
-    glutSolidCube(1.0f);
-    glPopMatrix();
-    // Tênis
-    glTranslatef(0.0f, -legL/2 - footH*0.5f, footL*0.3f);
-    glColor3fv(shoes);
-    glPushMatrix();
-    glScalef(legR*1.2f, footH, footL);
-    glutSolidCube(1.0f);
-    glPopMatrix();
-    glPopMatrix();
-
-    // Perna direita
-    glPushMatrix();
-    glTranslatef(bodyW*0.22f, -bodyH/2, 0.0f);
-    glRotatef(legSwing2, 1, 0, 0);
-    // Quadril
-    glColor3fv(pants);
-    glutSolidSphere(legR*1.1f, 10, 8);
-    // Perna
-    glTranslatef(0.0f, -legL/2, 0.0f);
-    glPushMatrix();
-    glColor3fv(pants);
-    glScalef(legR, legL, legR);
-    glutSolidCube(1.0f);
-    glPopMatrix();
-    // Tênis
-    glTranslatef(0.0f, -legL/2 - footH*0.5f, footL*0.3f);
-    glColor3fv(shoes);
-    glPushMatrix();
-    glScalef(legR*1.2f, footH, footL);
-    glutSolidCube(1.0f);
-    glPopMatrix();
-    glPopMatrix();
-}
-
 void Player::jump() {
     if (!isJumping && !isSliding) {
         isJumping = true;
@@ -286,35 +130,58 @@ void Player::moveRight() {
 }
 
 Vector3 Player::getMin() const {
-    float scaleX = size;
-    float scaleY = size;
-    float scaleZ = size;
-    
-    if (isSliding) {
-        scaleX *= 1.5f;
-        scaleY *= 0.5f;
-        scaleZ *= 1.2f;
-    }
-    
-    return Vector3(position.x - scaleX/2, position.y - scaleY/2, position.z - scaleZ/2);
+    PlayerPose pose = { position, isJumping, isSliding };
+    Vector3 min, max;
+    getBounds(pose, min, max);
+    return min;
 }
 
 Vector3 Player::getMax() const {
+    PlayerPose pose = { position, isJumping, isSliding };
+    Vector3 min, max;
+    getBounds(pose, min, max);
+    return max;
+}
+
+void Player::getBounds(const PlayerPose& pose, Vector3& min, Vector3& max) const {
     float scaleX = size;
     float scaleY = size;
     float scaleZ = size;
     
-    if (isSliding) {
+    if (pose.sliding) {
         scaleX *= 1.5f;
         scaleY *= 0.5f;
         scaleZ *= 1.2f;
     }
     
-    return Vector3(position.x + scaleX/2, position.y + scaleY/2, position.z + scaleZ/2);
+    min = Vector3(pose.position.x - scaleX/2, pose.position.y - scaleY/2, pose.position.z - scaleZ/2);
+    max = Vector3(pose.position.x + scaleX/2, pose.position.y + scaleY/2, pose.position.z + scaleZ/2);
+}
+
+uint32_t Player::hashState(uint32_t hash) const {
+    hash = Hash::combine(hash, position);
+    hash = Hash::combine(hash, velocity);
+    hash = Hash::combine(hash, currentLane);
+    hash = Hash::combine(hash, targetLane);
+    hash = Hash::combine(hash, laneTransitionTime);
+    hash = Hash::combine(hash, isJumping);
+    hash = Hash::combine(hash, isSliding);
+    hash = Hash::combine(hash, jumpTime);
+    hash = Hash::combine(hash, slideTime);
+    return hash;
+}
+
+bool Player::isValidState() const {
+    return currentLane >= 0 && currentLane <= 2 && targetLane >= 0 && targetLane <= 2;
+}
+
+Vector3 Player::getRenderPosition(float alpha) const {
+    return previousPosition + (position - previousPosition) * alpha;
 }
 
 void Player::reset() {
     position = Vector3(0.0f, GROUND_Y, 0.0f);
+    previousPosition = position;
     velocity = Vector3(0.0f, 0.0f, 0.0f);
     currentLane = 1;
     targetLane = 1;
@@ -2,11 +2,24 @@
 #define PLAYER_H
 
 #include "../utils/Vector3.h"
-#include <GL/glut.h>
+#include <cstdint>
 
+// Pose do jogador num instante: onde está e em que movimento
+struct PlayerPose {
+    Vector3 position;
+    bool jumping;
+    bool sliding;
+};
+
+// O movimento do jogador é feito de curvas fechadas em função do tempo
+// desde o início de cada movimento: smoothstep entre faixas, parábola no
+// pulo e reta no deslize. O tick só avança esses tempos e avalia as curvas,
+// então a altura do pulo não depende do passo, e predict(t) responde onde
+// o jogador estará daqui a t segundos (sem novos comandos) sem simular.
 class Player {
 private:
     Vector3 position;
+    Vector3 previousPosition; // Posição no tick anterior (interpolação)
     Vector3 velocity;
     int currentLane;        // 0 = esquerda, 1 = centro, 2 = direita
     int targetLane;         // Faixa para onde está se movendo
@@ -28,13 +41,20 @@ private:
     static const float SLIDE_HEIGHT;
     static const float LANE_TRANSITION_SPEED;
     
+    // Curvas do movimento (tempo desde a decolagem / início do deslize)
+    static float jumpCurve(float t);
+    static float slideCurve(float t);
+    
 public:
+    // Duração total do pulo (decolagem até tocar o chão)
+    static const float JUMP_DURATION;
+    
+
     Player();
-    ~Player();
     
     void update(float deltaTime);
-    void render();
-    void drawCharacter(float t, bool sliding);
+    void render(float alpha = 1.0f) const;
+    void drawCharacter(float t, bool sliding) const;
     void jump();
     void slide();
     void moveLeft();
@@ -42,14 +62,30 @@ public:
     
     // Getters
     Vector3 getPosition() const { return position; }
+    Vector3 getPreviousPosition() const { return previousPosition; }
+    Vector3 getRenderPosition(float alpha) const;
     Vector3 getSize() const { return Vector3(size, size, size); }
     bool getIsJumping() const { return isJumping; }
     bool getIsSliding() const { return isSliding; }
     int getCurrentLane() const { return currentLane; }
+    int getTargetLane() const { return targetLane; }
+    
+    // Pose daqui a t segundos (t >= 0) se nenhum comando novo chegar
+    PlayerPose predict(float t) const;
     
     // Para detecção de colisão
     Vector3 getMin() const;
     Vector3 getMax() const;
+    // Caixa do jogador numa pose qualquer (ex.: uma pose prevista)
+    void getBounds(const PlayerPose& pose, Vector3& min, Vector3& max) const;
+    
+    // Combina o estado da simulação ao hash (checksum de replay)
+    uint32_t hashState(uint32_t hash) const;
+    // Faixas dentro da pista (estado vindo de um snapshot em disco)
+    bool isValidState() const;
+    
+    // Guarda o estado atual antes de avançar um tick de simulação
+    void storePreviousState() { previousPosition = position; }
     
     void reset();
 };
@@ -0,0 +1,277 @@
+#include "Replay.h"
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <cstring>
+
+static const char REPLAY_MAGIC[4] = {'C', 'D', 'R', 'P'};
+static const uint16_t REPLAY_VERSION = 8;
+
+// Funções auxiliares de escrita/leitura em little-endian
+static void writeBytes(std::vector<unsigned char>& out, uint64_t value, int count) {
+    for (int i = 0; i < count; i++) {
+        out.push_back((unsigned char)(value >> (8 * i)));
+    }
+}
+
+static void writeFloat(std::vector<unsigned char>& out, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    writeBytes(out, bits, 4);
+}
+
+static void writeVarint(std::vector<unsigned char>& out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back((unsigned char)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((unsigned char)value);
+}
+
+// Leitor com verificação de limites
+struct ByteReader {
+    const std::vector<unsigned char>& bytes;
+    size_t offset;
+    bool ok;
+    
+    ByteReader(const std::vector<unsigned char>& bytes) : bytes(bytes), offset(0), ok(true) {}
+    
+    uint64_t read(int count) {
+        if (offset + count > bytes.size()) {
+            ok = false;
+            return 0;
+        }
+        uint64_t value = 0;
+        for (int i = 0; i < count; i++) {
+            value |= (uint64_t)bytes[offset++] << (8 * i);
+        }
+        return value;
+    }
+    
+    float readFloat() {
+        uint32_t bits = (uint32_t)read(4);
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+    
+    uint32_t readVarint() {
+        uint32_t value = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            uint32_t byte = (uint32_t)read(1);
+            if (!ok) return 0;
+            value |= (byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return value;
+        }
+        ok = false;
+        return 0;
+    }
+};
+
+ReplayData::ReplayData() {
+    seed = 0;
+    tickRate = 120;
+    hasStartSnapshot = false;
+    memset((void*)&startSnapshot, 0, sizeof(startSnapshot));
+}
+
+bool ReplayData::save(const std::string& filename) const {
+    std::vector<unsigned char> out;
+    out.insert(out.end(), REPLAY_MAGIC, REPLAY_MAGIC + 4);
+    writeBytes(out, REPLAY_VERSION, 2);
+    writeBytes(out, tickRate, 2);
+    writeBytes(out, seed, 8);
+    
+    writeFloat(out, params.speedIncreaseInterval);
+    writeFloat(out, params.speedIncreaseAmount);
+    writeFloat(out, params.spawnIntervalBase);
+    writeFloat(out, params.spawnIntervalSlope);
+    writeFloat(out, params.doubleSpawnChance);
+    writeBytes(out, (uint32_t)params.maxObstacles, 4);
+    
+    // Snapshot inicial: o bloco POD inteiro, como no arquivo de estado
+    out.push_back(hasStartSnapshot ? 1 : 0);
+    if (hasStartSnapshot) {
+        writeBytes(out, (uint32_t)sizeof(WorldSnapshot), 4);
+        const unsigned char* block = (const unsigned char*)&startSnapshot;
+        out.insert(out.end(), block, block + sizeof(WorldSnapshot));
+    }
+    
+    // Eventos: delta de tick em varint (quase sempre 1-2 bytes)
+    writeBytes(out, (uint32_t)events.size(), 4);
+    uint32_t lastTick = 0;
+    for (const auto& event : events) {
+        writeVarint(out, event.tick - lastTick);
+        out.push_back(event.action);
+        lastTick = event.tick;
+    }
+    
+    writeBytes(out, (uint32_t)checksums.size(), 4);
+    for (uint32_t checksum : checksums) {
+        writeBytes(out, checksum, 4);
+    }
+    
+    std::ofstream file(filename.c_str(), std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Erro: não foi possível gravar o replay " << filename << std::endl;
+        return false;
+    }
+    file.write((const char*)out.data(), out.size());
+    return file.good();
+}
+
+bool ReplayData::load(const std::string& filename) {
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Erro: não foi possível abrir o replay " << filename << std::endl;
+        return false;
+    }
+    std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    
+    if (bytes.size() < 4 || memcmp(bytes.data(), REPLAY_MAGIC, 4) != 0) {
+        std::cerr << "Erro: " << filename << " não é um replay válido" << std::endl;
+        return false;
+    }
+    
+    ByteReader reader(bytes);
+    reader.offset = 4;
+    uint16_t version = (uint16_t)reader.read(2);
+    if (version != REPLAY_VERSION) {
+        std::cerr << "Erro: versão de replay não suportada (" << version << ")" << std::endl;
+        return false;
+    }
+    tickRate = (uint16_t)reader.read(2);
+    seed = reader.read(8);
+    
+    params.speedIncreaseInterval = reader.readFloat();
+    params.speedIncreaseAmount = reader.readFloat();
+    params.spawnIntervalBase = reader.readFloat();
+    params.spawnIntervalSlope = reader.readFloat();
+    params.doubleSpawnChance = reader.readFloat();
+    params.maxObstacles = (int)reader.read(4);
+    
+    hasStartSnapshot = reader.read(1) != 0;
+    if (hasStartSnapshot) {
+        uint32_t size = (uint32_t)reader.read(4);
+        if (!reader.ok || size != sizeof(WorldSnapshot) || reader.offset + size > bytes.size()) {
+            std::cerr << "Erro: snapshot inicial do replay incompatível: " << filename << std::endl;
+            return false;
+        }
+        memcpy((void*)&startSnapshot, bytes.data() + reader.offset, size);
+        reader.offset += size;
+        if (!startSnapshot.isValid()) {
+            std::cerr << "Erro: snapshot inicial do replay incompatível: " << filename << std::endl;
+            return false;
+        }
+    }
+    
+    uint32_t eventCount = (uint32_t)reader.read(4);
+    events.clear();
+    uint32_t tick = 0;
+    for (uint32_t i = 0; i < eventCount && reader.ok; i++) {
+        ReplayEvent event;
+        tick += reader.readVarint();
+        event.tick = tick;
+        event.action = (uint8_t)reader.read(1);
+        events.push_back(event);
+    }
+    
+    uint32_t tickCount = (uint32_t)reader.read(4);
+    checksums.clear();
+    for (uint32_t i = 0; i < tickCount && reader.ok; i++) {
+        checksums.push_back((uint32_t)reader.read(4));
+    }
+    
+    if (!reader.ok || tickRate == 0) {
+        std::cerr << "Erro: replay truncado ou corrompido: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+ReplayRecorder::ReplayRecorder() {
+    recording = false;
+}
+
+bool ReplayRecorder::begin(const World& world, int tickRate) {
+    data = ReplayData();
+    data.seed = world.getSeed();
+    data.tickRate = (uint16_t)tickRate;
+    data.params = world.getParams();
+    
+    // Partida em andamento: a seed sozinha não reproduz o estado atual
+    if (world.getTickCount() > 0) {
+        if (!world.saveSnapshot(data.startSnapshot)) {
+            recording = false;
+            return false;
+        }
+        data.hasStartSnapshot = true;
+    }
+    recording = true;
+    return true;
+}
+
+void ReplayRecorder::recordInput(const World& world, InputAction action) {
+    if (!recording) return;
+    ReplayEvent event;
+    event.tick = (uint32_t)world.getTickCount();
+    event.action = (uint8_t)action;
+    data.events.push_back(event);
+}
+
+void ReplayRecorder::recordTick(const World& world) {
+    if (!recording) return;
+    data.checksums.push_back(world.checksum());
+}
+
+ReplayPlayer::ReplayPlayer() {
+    nextEvent = 0;
+    startTick = 0;
+    divergenceTick = -1;
+}
+
+bool ReplayPlayer::load(const std::string& filename) {
+    return data.load(filename);
+}
+
+bool ReplayPlayer::start(World& world) {
+    world.setParams(data.params);
+    world.reset(data.seed);
+    nextEvent = 0;
+    divergenceTick = -1;
+    
+    if (data.hasStartSnapshot && !world.loadSnapshot(data.startSnapshot)) {
+        startTick = 0;
+        return false;
+    }
+    startTick = world.getTickCount();
+    return true;
+}
+
+void ReplayPlayer::applyInputs(World& world) {
+    uint32_t tick = (uint32_t)world.getTickCount();
+    while (nextEvent < data.events.size() && data.events[nextEvent].tick <= tick) {
+        uint8_t action = data.events[nextEvent].action;
+        if (action < INPUT_ACTION_COUNT) {
+            world.applyInput((InputAction)action);
+        }
+        nextEvent++;
+    }
+}
+
+bool ReplayPlayer::verifyTick(const World& world) {
+    long long index = world.getTickCount() - startTick - 1;
+    if (index < 0 || index >= (long long)data.checksums.size()) return true;
+    
+    if (world.checksum() != data.checksums[index]) {
+        if (divergenceTick < 0) {
+            divergenceTick = world.getTickCount();
+        }
+        return false;
+    }
+    return true;
+}
+
+bool ReplayPlayer::isFinished(const World& world) const {
+    return world.getTickCount() - startTick >= (long long)data.checksums.size();
+}
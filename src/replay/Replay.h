@@ -0,0 +1,95 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "../world/World.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Evento de entrada gravado: aplicado antes do tick (tick + 1)
+struct ReplayEvent {
+    uint32_t tick;
+    uint8_t action;
+};
+
+// Conteúdo de um replay: seed e parâmetros da partida, entradas com o tick
+// em que foram aplicadas e o checksum do estado após cada tick. Uma gravação
+// que começa no meio de uma partida (por exemplo depois de carregar um
+// estado salvo) guarda também o snapshot inicial.
+//
+// Formato binário (little-endian):
+//   "CDRP" | versão u16 | ticks/s u16 | seed u64 | DifficultyParams
+//   | snapshot inicial u8 (0/1) [| tamanho u32 | WorldSnapshot]
+//   | nº de eventos u32 | eventos (delta de tick em varint + ação u8)
+//   | nº de ticks u32 | checksums u32
+struct ReplayData {
+    uint64_t seed;
+    uint16_t tickRate;
+    DifficultyParams params;
+    bool hasStartSnapshot;
+    WorldSnapshot startSnapshot;
+    std::vector<ReplayEvent> events;
+    std::vector<uint32_t> checksums;
+    
+    ReplayData();
+    
+    bool save(const std::string& filename) const;
+    bool load(const std::string& filename);
+};
+
+// Grava as entradas e os checksums de uma partida
+class ReplayRecorder {
+private:
+    ReplayData data;
+    bool recording;
+    
+public:
+    ReplayRecorder();
+    
+    // Começa a gravar a partida atual do mundo; se ela já começou, o estado
+    // atual vai junto como ponto de partida
+    bool begin(const World& world, int tickRate);
+    void stop() { recording = false; }
+    
+    // Registra uma entrada aplicada antes do próximo tick
+    void recordInput(const World& world, InputAction action);
+    // Registra o checksum após um tick
+    void recordTick(const World& world);
+    
+    bool save(const std::string& filename) const { return data.save(filename); }
+    bool isRecording() const { return recording; }
+    const ReplayData& getData() const { return data; }
+};
+
+// Reproduz um replay tick a tick, verificando os checksums
+class ReplayPlayer {
+private:
+    ReplayData data;
+    size_t nextEvent;
+    long long startTick;      // Tick do mundo no início da gravação
+    long long divergenceTick; // Primeiro tick divergente (-1 = nenhum)
+    
+public:
+    ReplayPlayer();
+    
+    bool load(const std::string& filename);
+    void setData(const ReplayData& replay) { data = replay; }
+    
+    // Reinicia o mundo com a seed e os parâmetros gravados (e o snapshot
+    // inicial, se houver); false se o snapshot não pôde ser restaurado
+    bool start(World& world);
+    
+    // Aplica as entradas do próximo tick (chamar antes de World::tick)
+    void applyInputs(World& world);
+    
+    // Compara o checksum após o tick; retorna false na primeira divergência
+    bool verifyTick(const World& world);
+    
+    bool isFinished(const World& world) const;
+    long long getDivergenceTick() const { return divergenceTick; }
+    long long getTotalTicks() const { return (long long)data.checksums.size(); }
+    float getStepSize() const { return 1.0f / data.tickRate; }
+    const ReplayData& getData() const { return data; }
+};
+
+#endif // REPLAY_H
@@ -0,0 +1,166 @@
+#include "RewindBuffer.h"
+#include <cstring>
+
+static_assert(sizeof(WorldSnapshot) % sizeof(uint32_t) == 0, "WorldSnapshot precisa ter tamanho múltiplo de 4");
+
+// Cada delta é uma sequência de tokens cobrindo todas as palavras do snapshot:
+// token = zeros (16 bits baixos) | literais (16 bits altos), seguido das
+// palavras literais (XOR com o tick anterior).
+static inline uint32_t makeToken(int zeros, int literals) {
+    return (uint32_t)zeros | ((uint32_t)literals << 16);
+}
+
+RewindBuffer::RewindBuffer(int windowTicks, int keyframeInterval, int segmentBudget)
+    : keyframeInterval(keyframeInterval), segmentBudget(segmentBudget) {
+    // Um segmento a mais para a janela inteira caber com o mais novo incompleto
+    int segmentCount = (windowTicks + keyframeInterval - 1) / keyframeInterval + 1;
+    segments.resize(segmentCount);
+    for (size_t i = 0; i < segments.size(); i++) {
+        segments[i].data.resize(segmentBudget);
+        segments[i].offsets.resize(keyframeInterval + 1);
+    }
+    // Pior caso: token e literal alternados
+    encoded.resize(SNAPSHOT_WORDS * 2 + 1);
+    clear();
+}
+
+void RewindBuffer::clear() {
+    head = 0;
+    used = 0;
+    newestTick = -1;
+}
+
+long long RewindBuffer::getOldestTick() const {
+    return used > 0 ? segmentAt(0).firstTick : -1;
+}
+
+int RewindBuffer::findSegment(long long tick) const {
+    for (int i = used - 1; i >= 0; i--) {
+        const Segment& segment = segmentAt(i);
+        if (tick >= segment.firstTick) {
+            return tick <= segment.firstTick + segment.deltaCount ? i : -1;
+        }
+    }
+    return -1;
+}
+
+void RewindBuffer::startSegment(long long tick) {
+    if (used == (int)segments.size()) {
+        // Anel cheio: o segmento mais antigo sai da janela
+        head = (head + 1) % segments.size();
+        used--;
+    }
+    Segment& segment = segmentAt(used);
+    used++;
+    memcpy(segment.keyframe, current, sizeof(segment.keyframe));
+    segment.firstTick = tick;
+    segment.deltaCount = 0;
+    segment.offsets[0] = 0;
+}
+
+bool RewindBuffer::appendDelta() {
+    Segment& segment = segmentAt(used - 1);
+    if (segment.deltaCount >= keyframeInterval - 1) return false;
+    
+    int size = 0;
+    int word = 0;
+    while (word < SNAPSHOT_WORDS) {
+        int zeroStart = word;
+        while (word < SNAPSHOT_WORDS && current[word] == last[word]) word++;
+        int zeros = word - zeroStart;
+        
+        int tokenIndex = size++;
+        int literalStart = word;
+        while (word < SNAPSHOT_WORDS && current[word] != last[word]) {
+            encoded[size++] = current[word] ^ last[word];
+            word++;
+        }
+        encoded[tokenIndex] = makeToken(zeros, word - literalStart);
+    }
+    
+    int start = segment.offsets[segment.deltaCount];
+    if (start + size > segmentBudget) return false;
+    memcpy(&segment.data[start], encoded.data(), size * sizeof(uint32_t));
+    segment.deltaCount++;
+    segment.offsets[segment.deltaCount] = start + size;
+    return true;
+}
+
+void RewindBuffer::decode(int index, long long tick, uint32_t* out) const {
+    const Segment& segment = segmentAt(index);
+    memcpy(out, segment.keyframe, sizeof(segment.keyframe));
+    
+    int deltas = (int)(tick - segment.firstTick);
+    const uint32_t* data = segment.data.data();
+    int position = 0;
+    for (int k = 0; k < deltas; k++) {
+        int word = 0;
+        while (word < SNAPSHOT_WORDS) {
+            uint32_t token = data[position++];
+            word += token & 0xFFFF;
+            int literals = token >> 16;
+            for (int i = 0; i < literals; i++) {
+                out[word++] ^= data[position++];
+            }
+        }
+    }
+}
+
+bool RewindBuffer::truncate(long long tick) {
+    int index = findSegment(tick);
+    if (index < 0) return false;
+    
+    used = index + 1;
+    Segment& segment = segmentAt(index);
+    segment.deltaCount = (int)(tick - segment.firstTick);
+    decode(index, tick, last);
+    newestTick = tick;
+    return true;
+}
+
+bool RewindBuffer::record(const World& world) {
+    long long tick = world.getTickCount();
+    if (used > 0 && tick != newestTick + 1 && !truncate(tick - 1)) {
+        clear();
+    }
+    
+    WorldSnapshot snapshot;
+    if (!world.saveSnapshot(snapshot)) {
+        clear();
+        return false;
+    }
+    memcpy(current, &snapshot, sizeof(WorldSnapshot));
+    
+    // Novo keyframe a cada intervalo, ou quando o orçamento do segmento acaba
+    if (used == 0 || !appendDelta()) {
+        startSegment(tick);
+    }
+    memcpy(last, current, sizeof(last));
+    newestTick = tick;
+    return true;
+}
+
+bool RewindBuffer::seek(World& world, long long tick) const {
+    int index = findSegment(tick);
+    if (index < 0) return false;
+    
+    WorldSnapshot snapshot;
+    uint32_t words[SNAPSHOT_WORDS];
+    decode(index, tick, words);
+    memcpy(&snapshot, words, sizeof(WorldSnapshot));
+    return world.loadSnapshot(snapshot);
+}
+
+size_t RewindBuffer::getReservedBytes() const {
+    size_t perSegment = sizeof(Segment) + segmentBudget * sizeof(uint32_t) + (keyframeInterval + 1) * sizeof(int);
+    return sizeof(RewindBuffer) + segments.size() * perSegment + encoded.size() * sizeof(uint32_t);
+}
+
+size_t RewindBuffer::getDeltaBytes() const {
+    size_t bytes = 0;
+    for (int i = 0; i < used; i++) {
+        const Segment& segment = segmentAt(i);
+        bytes += segment.offsets[segment.deltaCount] * sizeof(uint32_t);
+    }
+    return bytes;
+}
@@ -0,0 +1,82 @@
+#ifndef REWIND_BUFFER_H
+#define REWIND_BUFFER_H
+
+#include "../world/World.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Histórico dos últimos segundos de jogo para voltar no tempo após uma colisão.
+//
+// Um anel de segmentos, cada um com um keyframe (WorldSnapshot completo) e
+// os ticks seguintes codificados como o XOR com o tick anterior, em palavras
+// de 32 bits, com as sequências de zeros comprimidas (RLE). Cada segmento tem
+// um orçamento fixo para os deltas: se um delta não couber, começa um novo
+// keyframe. A memória total é fixa e voltar a um tick qualquer decodifica no
+// máximo um intervalo de keyframe.
+class RewindBuffer {
+public:
+    static const int SNAPSHOT_WORDS = sizeof(WorldSnapshot) / sizeof(uint32_t);
+    
+    static const int DEFAULT_WINDOW_TICKS = 600;           // 5 s a 120 Hz
+    static const int DEFAULT_KEYFRAME_INTERVAL = 30;
+    static const int DEFAULT_SEGMENT_BUDGET = 4096;        // Palavras de delta por segmento
+    
+private:
+    struct Segment {
+        uint32_t keyframe[SNAPSHOT_WORDS];
+        long long firstTick;           // Tick do keyframe
+        int deltaCount;                // Ticks depois do keyframe
+        std::vector<uint32_t> data;    // Deltas codificados (capacidade fixa)
+        std::vector<int> offsets;      // offsets[k] = início do delta k; offsets[deltaCount] = fim
+    };
+    
+    std::vector<Segment> segments;     // Anel
+    int head;                          // Segmento mais antigo
+    int used;                          // Segmentos em uso
+    int keyframeInterval;
+    int segmentBudget;
+    long long newestTick;
+    
+    // Último tick gravado (base do próximo XOR) e áreas de trabalho
+    uint32_t last[SNAPSHOT_WORDS];
+    uint32_t current[SNAPSHOT_WORDS];
+    std::vector<uint32_t> encoded;
+    
+    Segment& segmentAt(int i) { return segments[(head + i) % segments.size()]; }
+    const Segment& segmentAt(int i) const { return segments[(head + i) % segments.size()]; }
+    // Índice (0 = mais antigo) do segmento com o tick, ou -1
+    int findSegment(long long tick) const;
+    
+    void startSegment(long long tick);
+    bool appendDelta();
+    // Reconstrói em out o estado do tick (que precisa estar na janela)
+    void decode(int segment, long long tick, uint32_t* out) const;
+    // Descarta tudo depois do tick (para continuar de um ponto anterior)
+    bool truncate(long long tick);
+    
+public:
+    explicit RewindBuffer(int windowTicks = DEFAULT_WINDOW_TICKS,
+                          int keyframeInterval = DEFAULT_KEYFRAME_INTERVAL,
+                          int segmentBudget = DEFAULT_SEGMENT_BUDGET);
+    
+    void clear();
+    
+    // Grava o estado após um tick. Se o tick não for o seguinte ao último
+    // gravado (a partida voltou no tempo e continuou), o histórico depois
+    // dele é descartado. Retorna false se o estado não cabe num snapshot.
+    bool record(const World& world);
+    
+    // Restaura o World no tick pedido (entre getOldestTick e getNewestTick)
+    bool seek(World& world, long long tick) const;
+    
+    bool isEmpty() const { return used == 0; }
+    long long getOldestTick() const;
+    long long getNewestTick() const { return newestTick; }
+    
+    // Memória reservada (fixa) e memória ocupada pelos deltas
+    size_t getReservedBytes() const;
+    size_t getDeltaBytes() const;
+};
+
+#endif // REWIND_BUFFER_H
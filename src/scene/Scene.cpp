@@ -5,6 +5,7 @@
 
 Scene::Scene() {
     floorOffset = 0.0f;
+    previousFloorOffset = 0.0f;
     floorSpeed = 20.0f;
 }
 
@@ -28,15 +29,22 @@ void Scene::update(float deltaTime) {
     }
 }
 
-void Scene::render() {
+void Scene::render(float alpha) {
+    // Interpolar o offset do chão, considerando a volta em 100 unidades
+    float previous = previousFloorOffset;
+    if (floorOffset < previous) {
+        previous -= 100.0f;
+    }
+    float offset = previous + (floorOffset - previous) * alpha;
+    
     renderSkybox();
     
-    renderFloor();
+    renderFloor(offset);
     
     // renderLanes(); // Comentado para remover traços e pontilhados
 }
 
-void Scene::renderFloor() {
+void Scene::renderFloor(float offset) {
     glPushMatrix();
     
     // Habilitar texturas
@@ -54,11 +62,11 @@ void Scene::renderFloor() {
     float textureRepeat = 1.0f;
     
     for (int i = 0; i < numSegments; i++) {
-        float z1 = floorOffset - (i * segmentLength);
+        float z1 = offset - (i * segmentLength);
         float z2 = z1 - segmentLength;
         
         // Calcular offset da textura baseado no movimento
-        float texOffsetY = (floorOffset / segmentLength) + i;
+        float texOffsetY = (offset / segmentLength) + i;
         
         glBegin(GL_QUADS);
             // Coordenadas de textura com movimento
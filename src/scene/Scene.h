@@ -7,9 +7,10 @@
 class Scene {
 private:
     float floorOffset;
+    float previousFloorOffset; // Offset no tick anterior (interpolação)
     float floorSpeed;
     
-    void renderFloor();
+    void renderFloor(float offset);
     void renderSkybox();
     void renderLanes();
     
@@ -19,9 +20,12 @@ public:
     
     void init();
     void update(float deltaTime);
-    void render();
+    void render(float alpha = 1.0f);
     void setupCamera();
     
+    // Guarda o estado atual antes de avançar um tick de simulação
+    void storePreviousState() { previousFloorOffset = floorOffset; }
+    
     void setFloorSpeed(float speed);
     float getFloorSpeed() const;
 };
@@ -15,7 +15,6 @@ private:
     
 public:
     Score();
-    ~Score();
     
     void startGame();
     void update(float deltaTime);
@@ -27,6 +26,7 @@ public:
     
     int getCurrentScore() const;
     int getHighScore() const;
+    void setHighScore(int value) { highScore = value; }
     float getGameTime() const;
     bool isActive() const;
 };
@@ -1,26 +1,131 @@
 #include "Texture.h"
-#include <iostream>
-#include <fstream>
+#include "../utils/Hash.h"
+#include "../utils/Random.h"
+#include "../utils/ThreadPool.h"
+#include <GL/freeglut_ext.h>
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
-#include <cmath>
 #include <cstring>
+#include <iostream>
+#include <fstream>
+
+// GL_EXT_texture_filter_anisotropic (nem todo gl.h traz as constantes)
+#ifndef GL_TEXTURE_MAX_ANISOTROPY_EXT
+#define GL_TEXTURE_MAX_ANISOTROPY_EXT 0x84FE
+#endif
+#ifndef GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT
+#define GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT 0x84FF
+#endif
+
+// Recursos opcionais do driver, consultados uma vez (com o contexto GL ativo)
+typedef void (APIENTRY *GenerateMipmapProc)(GLenum target);
+static bool capabilitiesChecked = false;
+static GenerateMipmapProc generateMipmap = NULL;
+static float hardwareAnisotropy = 1.0f;
+
+static bool hasExtension(const char* name) {
+    const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+    if (!extensions) return false;
+    
+    // Comparar nomes inteiros (um nome pode ser prefixo de outro)
+    size_t length = strlen(name);
+    for (const char* found = strstr(extensions, name); found; found = strstr(found + length, name)) {
+        bool startsWord = (found == extensions || found[-1] == ' ');
+        bool endsWord = (found[length] == ' ' || found[length] == '\0');
+        if (startsWord && endsWord) return true;
+    }
+    return false;
+}
+
+static void checkCapabilities() {
+    if (capabilitiesChecked) return;
+    capabilitiesChecked = true;
+    
+    // glutGetProcAddress pode devolver um ponteiro mesmo sem suporte (GLX),
+    // então a versão/extensão é conferida antes
+    const char* version = (const char*)glGetString(GL_VERSION);
+    if ((version && atoi(version) >= 3) || hasExtension("GL_ARB_framebuffer_object")) {
+        generateMipmap = (GenerateMipmapProc)glutGetProcAddress("glGenerateMipmap");
+    } else if (hasExtension("GL_EXT_framebuffer_object")) {
+        generateMipmap = (GenerateMipmapProc)glutGetProcAddress("glGenerateMipmapEXT");
+    }
+    
+    if (hasExtension("GL_EXT_texture_filter_anisotropic") || hasExtension("GL_ARB_texture_filter_anisotropic")) {
+        glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &hardwareAnisotropy);
+    }
+    
+    std::cout << "Mipmaps: " << (generateMipmap ? "glGenerateMipmap" : "reduções 2x2 na CPU")
+              << ", anisotropia máxima " << hardwareAnisotropy << "x" << std::endl;
+}
 
 std::map<std::string, GLuint> Texture::textures;
 bool Texture::initialized = false;
+uint64_t Texture::seed = 0;
+std::string Texture::cacheDirectory;
+float Texture::maxAnisotropy = 16.0f;
 
-bool Texture::init() {
+bool Texture::init(uint64_t textureSeed) {
     if (initialized) return true;
     
+    seed = textureSeed;
+    
     std::cout << "Inicializando sistema de texturas..." << std::endl;
     
     // Habilitar texturas 2D
     glEnable(GL_TEXTURE_2D);
-    
-    // Criar texturas procedurais padrão
-    createGalaxyTexture("galaxy");
-    createStarFieldTexture("starfield");
-    createNebulaTexture("nebula");
-    createRocketTexture("rocket_metal");
+    checkCapabilities();
+    
+    // Criar texturas procedurais padrão. As que estão no cache em disco são
+    // só mapeadas; as faixas das demais são geradas juntas no pool. O upload
+    // fica nesta thread (contexto GL).
+    const int DEFAULT_SIZE = 512;
+    const ProceduralTexture kinds[] = { PROCEDURAL_GALAXY, PROCEDURAL_STARFIELD, PROCEDURAL_NEBULA, PROCEDURAL_ROCKET };
+    const char* names[] = { "galaxy", "starfield", "nebula", "rocket_metal" };
+    // O chão de galáxia se estende por 200 unidades, visto em ângulo raso: é
+    // o que mais ganha com anisotropia. O céu é visto quase de frente.
+    const TextureSampling samplings[] = {
+        TextureSampling(true, 8.0f),
+        TextureSampling(true, 1.0f),
+        TextureSampling(true, 1.0f),
+        TextureSampling(true, 4.0f)
+    };
+    const int defaultCount = sizeof(kinds) / sizeof(kinds[0]);
+    TextureImage images[defaultCount];
+    MappedTexture cached[defaultCount];
+    uint64_t keys[defaultCount];
+    TextureCache cache(cacheDirectory);
+    int generated = 0;
+    
+    auto startTime = std::chrono::steady_clock::now();
+    {
+        ThreadPool pool;
+        for (int i = 0; i < defaultCount; i++) {
+            keys[i] = TextureCache::makeKey(names[i], DEFAULT_SIZE, DEFAULT_SIZE, seedFor(names[i]));
+            if (!cacheDirectory.empty() && cache.load(keys[i], DEFAULT_SIZE, DEFAULT_SIZE, cached[i])) {
+                continue;
+            }
+            TextureGenerator::allocate(images[i], DEFAULT_SIZE, DEFAULT_SIZE);
+            TextureGenerator::submit(pool, kinds[i], seedFor(names[i]), images[i]);
+            generated++;
+        }
+        pool.wait();
+    }
+    double prepareMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    
+    for (int i = 0; i < defaultCount; i++) {
+        if (exists(names[i])) continue;
+        if (cached[i].isOpen()) {
+            upload(names[i], cached[i].getWidth(), cached[i].getHeight(), cached[i].getPixels(), samplings[i]);
+        } else {
+            upload(names[i], images[i].width, images[i].height, images[i].pixels.data(), samplings[i]);
+            if (!cacheDirectory.empty()) {
+                cache.store(keys[i], images[i]);
+            }
+        }
+    }
+    std::cout << "Texturas procedurais: " << defaultCount - generated << " do cache, " << generated
+              << " geradas (" << ThreadPool::defaultThreadCount() << " threads) em " << prepareMs << " ms" << std::endl;
     
     initialized = true;
     std::cout << "Sistema de texturas inicializado com " << textures.size() << " texturas." << std::endl;
@@ -37,7 +142,21 @@ void Texture::cleanup() {
     std::cout << "Sistema de texturas finalizado." << std::endl;
 }
 
-GLuint Texture::loadTexture(const std::string& name, const std::string& filename) {
+void Texture::setCacheDirectory(const std::string& directory) {
+    cacheDirectory = directory;
+}
+
+void Texture::setMaxAnisotropy(float anisotropy) {
+    maxAnisotropy = std::max(1.0f, anisotropy);
+}
+
+uint64_t Texture::seedFor(const std::string& name) {
+    // Hash do nome para separar o fluxo de cada textura
+    uint64_t hash = Hash::fnv1a64(Hash::FNV64_OFFSET, name.data(), name.size());
+    return Random::deriveSeed(seed, hash);
+}
+
+GLuint Texture::loadTexture(const std::string& name, const std::string& filename, const TextureSampling& sampling) {
     // Verificar se já foi carregada
     if (textures.find(name) != textures.end()) {
         return textures[name];
@@ -51,355 +170,127 @@ GLuint Texture::loadTexture(const std::string& name, const std::string& filename
         return 0;
     }
     
-    GLuint textureId;
-    glGenTextures(1, &textureId);
-    glBindTexture(GL_TEXTURE_2D, textureId);
-    
-    // Configurar parâmetros da textura
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    
-    // Carregar dados da textura (usando GL_RGB em vez de GL_BGR)
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
+    // Dados já convertidos para RGB pelo loadBMP
+    GLuint textureId = upload(name, width, height, data, sampling);
     
     delete[] data;
     
-    textures[name] = textureId;
     std::cout << "Textura carregada: " << name << " (" << filename << ")" << std::endl;
     
     return textureId;
 }
 
-GLuint Texture::createGalaxyTexture(const std::string& name, int width, int height) {
-    // Verificar se já foi criada
-    if (textures.find(name) != textures.end()) {
-        return textures[name];
-    }
-    
-    std::cout << "Criando textura de galáxia procedural..." << std::endl;
-    
-    unsigned char* data = new unsigned char[width * height * 3];
-    
-    float centerX = width / 2.0f;
-    float centerY = height / 2.0f;
-    float maxRadius = std::min(centerX, centerY);
-    
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            int index = (y * width + x) * 3;
-            
-            // Calcular distância do centro
-            float dx = x - centerX;
-            float dy = y - centerY;
-            float distance = sqrt(dx * dx + dy * dy);
-            float normalizedDistance = distance / maxRadius;
-            
-            // Calcular ângulo para espiral
-            float angle = atan2(dy, dx);
-            float spiral = sin(angle * 3.0f + distance * 0.1f) * 0.5f + 0.5f;
-            
-            // Criar gradiente radial
-            float intensity = 1.0f - normalizedDistance;
-            intensity = std::max(0.0f, std::min(1.0f, intensity));
-            
-            // Adicionar ruído para variação
-            float noise = (rand() % 100) / 100.0f * 0.3f;
-            intensity += noise;
-            intensity = std::max(0.0f, std::min(1.0f, intensity));
-            
-            // Combinar com espiral
-            intensity *= spiral * 0.7f + 0.3f;
-            
-            // Cores da galáxia (tons de azul, roxo e branco)
-            if (normalizedDistance < 0.3f) {
-                // Centro - branco/amarelo
-                data[index] = (unsigned char)(255 * intensity);     // R
-                data[index + 1] = (unsigned char)(240 * intensity); // G
-                data[index + 2] = (unsigned char)(200 * intensity); // B
-            } else if (normalizedDistance < 0.7f) {
-                // Meio - azul/ciano
-                data[index] = (unsigned char)(100 * intensity);     // R
-                data[index + 1] = (unsigned char)(150 * intensity); // G
-                data[index + 2] = (unsigned char)(255 * intensity); // B
-            } else {
-                // Borda - roxo/escuro
-                data[index] = (unsigned char)(80 * intensity);      // R
-                data[index + 1] = (unsigned char)(50 * intensity);  // G
-                data[index + 2] = (unsigned char)(120 * intensity); // B
-            }
-        }
-    }
+GLuint Texture::upload(const std::string& name, int width, int height, const unsigned char* pixels,
+                       const TextureSampling& sampling) {
+    checkCapabilities();
     
     GLuint textureId;
     glGenTextures(1, &textureId);
     glBindTexture(GL_TEXTURE_2D, textureId);
     
-    // Configurar parâmetros
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
+    // Linhas RGB dos níveis pequenos (2x2, 1x1) não têm múltiplos de 4 bytes
+    GLint previousAlignment;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &previousAlignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
     
-    delete[] data;
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, pixels);
+    if (sampling.mipmaps) {
+        buildMipmaps(width, height, pixels);
+    }
     
-    textures[name] = textureId;
-    std::cout << "Textura de galáxia criada: " << name << std::endl;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, previousAlignment);
+    applySampling(sampling);
     
+    textures[name] = textureId;
     return textureId;
 }
 
-GLuint Texture::createStarFieldTexture(const std::string& name, int width, int height) {
-    if (textures.find(name) != textures.end()) {
-        return textures[name];
+void Texture::buildMipmaps(int width, int height, const unsigned char* pixels) {
+    if (generateMipmap) {
+        generateMipmap(GL_TEXTURE_2D);
+        return;
     }
     
-    std::cout << "Criando textura de campo de estrelas..." << std::endl;
-    
-    unsigned char* data = new unsigned char[width * height * 3];
-    
-    // Preencher com preto
-    memset(data, 0, width * height * 3);
-    
-    // Adicionar estrelas aleatórias
-    int numStars = (width * height) / 1000; // Densidade de estrelas
-    
-    for (int i = 0; i < numStars; i++) {
-        int x = rand() % width;
-        int y = rand() % height;
-        int index = (y * width + x) * 3;
-        
-        // Intensidade aleatória da estrela
-        float intensity = 0.5f + (rand() % 100) / 200.0f;
-        unsigned char starColor = (unsigned char)(255 * intensity);
+    // Sem glGenerateMipmap: cada nível é a redução 2x2 do anterior, até 1x1
+    // (no OpenGL 1.x a cadeia precisa estar completa)
+    TextureImage current;
+    TextureImage next;
+    const unsigned char* source = pixels;
+    int level = 0;
+    while (width > 1 || height > 1) {
+        TextureGenerator::downsample(source, width, height, next);
+        level++;
+        glTexImage2D(GL_TEXTURE_2D, level, GL_RGB, next.width, next.height, 0, GL_RGB, GL_UNSIGNED_BYTE, next.pixels.data());
         
-        data[index] = starColor;     // R
-        data[index + 1] = starColor; // G
-        data[index + 2] = starColor; // B
-        
-        // Adicionar brilho ao redor (opcional)
-        if (rand() % 10 == 0) { // 10% das estrelas têm brilho
-            for (int dy = -1; dy <= 1; dy++) {
-                for (int dx = -1; dx <= 1; dx++) {
-                    int nx = x + dx;
-                    int ny = y + dy;
-                    if (nx >= 0 && nx < width && ny >= 0 && ny < height) {
-                        int nindex = (ny * width + nx) * 3;
-                        unsigned char glow = (unsigned char)(100 * intensity);
-                        data[nindex] = std::max(data[nindex], glow);
-                        data[nindex + 1] = std::max(data[nindex + 1], glow);
-                        data[nindex + 2] = std::max(data[nindex + 2], glow);
-                    }
-                }
-            }
-        }
+        std::swap(current, next);
+        source = current.pixels.data();
+        width = current.width;
+        height = current.height;
     }
-    
-    GLuint textureId;
-    glGenTextures(1, &textureId);
-    glBindTexture(GL_TEXTURE_2D, textureId);
-    
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-    
-    delete[] data;
-    
-    textures[name] = textureId;
-    std::cout << "Textura de campo de estrelas criada: " << name << std::endl;
-    
-    return textureId;
 }
 
-GLuint Texture::createNebulaTexture(const std::string& name, int width, int height) {
-    if (textures.find(name) != textures.end()) {
-        return textures[name];
-    }
-    
-    std::cout << "Criando textura de nebulosa..." << std::endl;
-    
-    unsigned char* data = new unsigned char[width * height * 3];
-    
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            int index = (y * width + x) * 3;
-            
-            // Criar padrão de nebulosa com múltiplas camadas de ruído
-            float nx = (float)x / width * 4.0f;
-            float ny = (float)y / height * 4.0f;
-            
-            float noise1 = sin(nx * 3.14159f) * cos(ny * 3.14159f);
-            float noise2 = sin(nx * 6.28318f) * cos(ny * 6.28318f) * 0.5f;
-            float noise3 = (rand() % 100) / 500.0f;
-            
-            float intensity = (noise1 + noise2 + noise3) * 0.5f + 0.5f;
-            intensity = std::max(0.0f, std::min(1.0f, intensity));
-            
-            // Cores de nebulosa (rosa, roxo, azul)
-            data[index] = (unsigned char)(120 * intensity + 30);     // R
-            data[index + 1] = (unsigned char)(80 * intensity + 20);  // G
-            data[index + 2] = (unsigned char)(160 * intensity + 40); // B
-        }
-    }
-    
-    GLuint textureId;
-    glGenTextures(1, &textureId);
-    glBindTexture(GL_TEXTURE_2D, textureId);
-    
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+void Texture::applySampling(const TextureSampling& sampling) {
+    // Trilinear: interpola dentro do nível e entre os dois níveis mais próximos
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, sampling.mipmaps ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-    
-    delete[] data;
-    
-    textures[name] = textureId;
-    std::cout << "Textura de nebulosa criada: " << name << std::endl;
-    
-    return textureId;
+    if (hardwareAnisotropy > 1.0f) {
+        float anisotropy = std::max(1.0f, std::min(sampling.anisotropy, std::min(maxAnisotropy, hardwareAnisotropy)));
+        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, anisotropy);
+    }
 }
 
-GLuint Texture::createRocketTexture(const std::string& name, int width, int height) {
+GLuint Texture::createProcedural(ProceduralTexture kind, const std::string& name, int width, int height,
+                                 const TextureSampling& sampling) {
+    // Verificar se já foi criada
     if (textures.find(name) != textures.end()) {
         return textures[name];
     }
     
-    std::cout << "Criando textura de foguete espacial..." << std::endl;
-    
-    unsigned char* data = new unsigned char[width * height * 3];
-    
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            int index = (y * width + x) * 3;
-            
-            // Base metálica cinza
-            unsigned char baseR = 130;
-            unsigned char baseG = 135;
-            unsigned char baseB = 150;
-            
-            // Adicionar padrão de placas metálicas hexagonais
-            int plateSize = 24;
-            int plateX = x / plateSize;
-            int plateY = y / plateSize;
-            
-            // Padrão hexagonal
-            bool isHexEdge = ((x % plateSize) < 2) || ((y % plateSize) < 2) || 
-                           ((x % plateSize) > plateSize - 3) || ((y % plateSize) > plateSize - 3);
-            
-            if (isHexEdge) {
-                // Bordas das placas - mais escuras
-                baseR = std::max(80, (int)baseR - 40);
-                baseG = std::max(80, (int)baseG - 40);
-                baseB = std::max(90, (int)baseB - 40);
-            } else {
-                // Centro das placas - variação aleatória
-                float plateVariation = ((plateX + plateY) % 4) * 0.08f;
-                baseR = (unsigned char)(baseR * (1.0f + plateVariation));
-                baseG = (unsigned char)(baseG * (1.0f + plateVariation));
-                baseB = (unsigned char)(baseB * (1.0f + plateVariation));
-            }
-            
-            // Adicionar detalhes de superfície metálica com ruído
-            float metalNoise = (rand() % 30) / 150.0f - 0.1f;
-            
-            // Linhas de soldas horizontais principais
-            if (y % 48 < 3) {
-                baseR = std::min(255, (int)baseR + 45);
-                baseG = std::min(255, (int)baseG + 35);
-                baseB = std::min(255, (int)baseB + 25);
-            }
-            
-            // Linhas de soldas verticais secundárias
-            if (x % 96 < 2) {
-                baseR = std::min(255, (int)baseR + 35);
-                baseG = std::min(255, (int)baseG + 30);
-                baseB = std::min(255, (int)baseB + 20);
-            }
-            
-            // Sistema de rebites mais detalhado
-            int rivetSpacing = 32;
-            int rivetX = x % rivetSpacing;
-            int rivetY = y % rivetSpacing;
-            float rivetDist = sqrt((rivetX - rivetSpacing/2) * (rivetX - rivetSpacing/2) + 
-                                 (rivetY - rivetSpacing/2) * (rivetY - rivetSpacing/2));
-            
-            if (rivetDist < 3) {
-                // Centro do rebite - muito brilhante
-                baseR = 200;
-                baseG = 205;
-                baseB = 220;
-            } else if (rivetDist < 5) {
-                // Anel do rebite - brilhante
-                baseR = std::min(255, (int)baseR + 50);
-                baseG = std::min(255, (int)baseG + 50);
-                baseB = std::min(255, (int)baseB + 60);
-            } else if (rivetDist < 7) {
-                // Sombra ao redor do rebite
-                baseR = std::max(50, (int)baseR - 25);
-                baseG = std::max(50, (int)baseG - 25);
-                baseB = std::max(60, (int)baseB - 25);
-            }
-            
-            // Adicionar arranhões e marcas de desgaste
-            if ((x + y * 7) % 150 < 2) {
-                // Arranhões brilhantes
-                baseR = std::min(255, (int)baseR + 60);
-                baseG = std::min(255, (int)baseG + 55);
-                baseB = std::min(255, (int)baseB + 70);
-            }
-            
-            // Manchas de oxidação ocasionais
-            if ((x * 3 + y * 5) % 200 < 3) {
-                baseR = std::max(100, (int)baseR - 20);
-                baseG = std::max(90, (int)baseG - 30);
-                baseB = std::max(80, (int)baseB - 40);
-            }
-            
-            // Padrão de identificação da nave (listras diagonais)
-            if ((x + y) % 64 < 4 && (x - y) % 64 < 4) {
-                baseR = std::min(255, (int)baseR + 30);
-                baseG = std::min(255, (int)baseG + 40);
-                baseB = std::min(255, (int)baseB + 60);
-            }
-            
-            // Aplicar variações finais
-            baseR = std::max(0, std::min(255, (int)(baseR * (1.0f + metalNoise))));
-            baseG = std::max(0, std::min(255, (int)(baseG * (1.0f + metalNoise))));
-            baseB = std::max(0, std::min(255, (int)(baseB * (1.0f + metalNoise))));
-            
-            data[index] = baseR;
-            data[index + 1] = baseG;
-            data[index + 2] = baseB;
-        }
-    }
-    
-    GLuint textureId;
-    glGenTextures(1, &textureId);
-    glBindTexture(GL_TEXTURE_2D, textureId);
+    uint64_t textureSeed = seedFor(name);
+    TextureCache cache(cacheDirectory);
+    uint64_t key = TextureCache::makeKey(name, width, height, textureSeed);
     
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    MappedTexture cached;
+    if (!cacheDirectory.empty() && cache.load(key, width, height, cached)) {
+        std::cout << "Textura de " << TextureGenerator::getName(kind) << " carregada do cache: " << name << std::endl;
+        return upload(name, width, height, cached.getPixels(), sampling);
+    }
     
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
+    std::cout << "Criando textura de " << TextureGenerator::getName(kind) << "..." << std::endl;
     
-    delete[] data;
+    TextureImage image;
+    TextureGenerator::allocate(image, width, height);
+    TextureGenerator::generate(kind, textureSeed, image);
     
-    textures[name] = textureId;
-    std::cout << "Textura de foguete espacial criada: " << name << std::endl;
+    GLuint textureId = upload(name, width, height, image.pixels.data(), sampling);
+    if (!cacheDirectory.empty()) {
+        cache.store(key, image);
+    }
+    std::cout << "Textura de " << TextureGenerator::getName(kind) << " criada: " << name << std::endl;
     
     return textureId;
 }
 
+GLuint Texture::createGalaxyTexture(const std::string& name, int width, int height, const TextureSampling& sampling) {
+    return createProcedural(PROCEDURAL_GALAXY, name, width, height, sampling);
+}
+
+GLuint Texture::createStarFieldTexture(const std::string& name, int width, int height, const TextureSampling& sampling) {
+    return createProcedural(PROCEDURAL_STARFIELD, name, width, height, sampling);
+}
+
+GLuint Texture::createNebulaTexture(const std::string& name, int width, int height, const TextureSampling& sampling) {
+    return createProcedural(PROCEDURAL_NEBULA, name, width, height, sampling);
+}
+
+GLuint Texture::createRocketTexture(const std::string& name, int width, int height, const TextureSampling& sampling) {
+    return createProcedural(PROCEDURAL_ROCKET, name, width, height, sampling);
+}
+
 GLuint Texture::getTexture(const std::string& name) {
     auto it = textures.find(name);
     if (it != textures.end()) {
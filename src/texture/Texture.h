@@ -2,29 +2,71 @@
 #define TEXTURE_H
 
 #include <GL/glut.h>
+#include <cstdint>
 #include <string>
 #include <map>
+#include "TextureGenerator.h"
+#include "TextureCache.h"
+
+// Filtragem de uma textura: com mipmaps a redução é trilinear
+// (GL_LINEAR_MIPMAP_LINEAR); anisotropy > 1 pede filtragem anisotrópica, se o
+// driver tiver a extensão (limitada pelo máximo do hardware e por
+// Texture::setMaxAnisotropy)
+struct TextureSampling {
+    bool mipmaps;
+    float anisotropy;
+    
+    TextureSampling(bool mipmaps = true, float anisotropy = 1.0f) : mipmaps(mipmaps), anisotropy(anisotropy) {}
+};
 
 class Texture {
 private:
     static std::map<std::string, GLuint> textures;
     static bool initialized;
+    static uint64_t seed;
+    static std::string cacheDirectory;  // Vazio: sem cache em disco
+    static float maxAnisotropy;         // Limite pedido pelo usuário (1 desliga)
+    
+    // Seed de uma textura procedural (derivada da seed global e do nome)
+    static uint64_t seedFor(const std::string& name);
+    
+    // Envia os pixels RGB ao OpenGL (só na thread do contexto GL), com a
+    // cadeia de mipmaps se pedida, e registra o nome
+    static GLuint upload(const std::string& name, int width, int height, const unsigned char* pixels,
+                         const TextureSampling& sampling);
+    // Níveis 1..n: glGenerateMipmap quando disponível, senão reduções 2x2 na CPU
+    static void buildMipmaps(int width, int height, const unsigned char* pixels);
+    static void applySampling(const TextureSampling& sampling);
+    static GLuint createProcedural(ProceduralTexture kind, const std::string& name, int width, int height,
+                                   const TextureSampling& sampling);
     
     // Função auxiliar para carregar imagem BMP
     static unsigned char* loadBMP(const std::string& filename, int& width, int& height);
     
 public:
-    static bool init();
+    // Inicializa as texturas procedurais a partir de uma seed (reproduzível)
+    static bool init(uint64_t textureSeed = 0);
     static void cleanup();
     
+    // Diretório do cache em disco das texturas procedurais (vazio desliga);
+    // deve ser definido antes de init
+    static void setCacheDirectory(const std::string& directory);
+    // Anisotropia máxima de todas as texturas (1 desliga); antes de init
+    static void setMaxAnisotropy(float anisotropy);
+    
     // Carregar textura de arquivo
-    static GLuint loadTexture(const std::string& name, const std::string& filename);
+    static GLuint loadTexture(const std::string& name, const std::string& filename,
+                              const TextureSampling& sampling = TextureSampling());
     
     // Criar texturas procedurais
-    static GLuint createGalaxyTexture(const std::string& name, int width = 512, int height = 512);
-    static GLuint createStarFieldTexture(const std::string& name, int width = 512, int height = 512);
-    static GLuint createNebulaTexture(const std::string& name, int width = 512, int height = 512);
-    static GLuint createRocketTexture(const std::string& name, int width = 512, int height = 512);
+    static GLuint createGalaxyTexture(const std::string& name, int width = 512, int height = 512,
+                                  const TextureSampling& sampling = TextureSampling());
+    static GLuint createStarFieldTexture(const std::string& name, int width = 512, int height = 512,
+                                  const TextureSampling& sampling = TextureSampling());
+    static GLuint createNebulaTexture(const std::string& name, int width = 512, int height = 512,
+                                  const TextureSampling& sampling = TextureSampling());
+    static GLuint createRocketTexture(const std::string& name, int width = 512, int height = 512,
+                                  const TextureSampling& sampling = TextureSampling());
     
     // Obter textura carregada
     static GLuint getTexture(const std::string& name);
@@ -0,0 +1,210 @@
+#include "TextureCache.h"
+#include "TextureGenerator.h"
+#include "../utils/Hash.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <direct.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+static const char CACHE_MAGIC[4] = {'C', 'D', 'T', 'X'};
+static const uint16_t CACHE_FORMAT = 1;
+
+static void writeBytes(std::vector<unsigned char>& out, uint64_t value, int count) {
+    for (int i = 0; i < count; i++) {
+        out.push_back((unsigned char)(value >> (8 * i)));
+    }
+}
+
+static uint64_t readBytes(const unsigned char* data, int count) {
+    uint64_t value = 0;
+    for (int i = 0; i < count; i++) {
+        value |= (uint64_t)data[i] << (8 * i);
+    }
+    return value;
+}
+
+MappedTexture::MappedTexture() {
+    mapping = nullptr;
+    mappedSize = 0;
+    width = 0;
+    height = 0;
+#ifdef _WIN32
+    fileHandle = INVALID_HANDLE_VALUE;
+    mappingHandle = NULL;
+#endif
+}
+
+MappedTexture::~MappedTexture() {
+    close();
+}
+
+bool MappedTexture::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE fileMapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (fileMapping == NULL) {
+        CloseHandle(file);
+        return false;
+    }
+    void* view = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == NULL) {
+        CloseHandle(fileMapping);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = fileMapping;
+    mapping = (const unsigned char*)view;
+    mappedSize = (size_t)size.QuadPart;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+    void* view = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // O mapeamento continua válido depois de fechar o descritor
+    ::close(fd);
+    if (view == MAP_FAILED) return false;
+
+    // O upload lê o arquivo inteiro logo em seguida
+    madvise(view, (size_t)info.st_size, MADV_WILLNEED);
+    mapping = (const unsigned char*)view;
+    mappedSize = (size_t)info.st_size;
+#endif
+    return true;
+}
+
+void MappedTexture::close() {
+    if (!mapping) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(mapping);
+    CloseHandle((HANDLE)mappingHandle);
+    CloseHandle((HANDLE)fileHandle);
+    fileHandle = INVALID_HANDLE_VALUE;
+    mappingHandle = NULL;
+#else
+    munmap((void*)mapping, mappedSize);
+#endif
+    mapping = nullptr;
+    mappedSize = 0;
+    width = 0;
+    height = 0;
+}
+
+const unsigned char* MappedTexture::getPixels() const {
+    return mapping ? mapping + TextureCache::HEADER_SIZE : nullptr;
+}
+
+TextureCache::TextureCache(const std::string& directory) : directory(directory) {
+}
+
+uint64_t TextureCache::makeKey(const std::string& name, int width, int height, uint64_t seed) {
+    uint32_t version = TextureGenerator::VERSION;
+    uint64_t hash = Hash::fnv1a64(Hash::FNV64_OFFSET, name.data(), name.size());
+    hash = Hash::fnv1a64(hash, &width, sizeof(width));
+    hash = Hash::fnv1a64(hash, &height, sizeof(height));
+    hash = Hash::fnv1a64(hash, &seed, sizeof(seed));
+    hash = Hash::fnv1a64(hash, &version, sizeof(version));
+    return hash;
+}
+
+std::string TextureCache::pathFor(uint64_t key) const {
+    std::stringstream path;
+    path << directory << "/" << std::hex << std::setw(16) << std::setfill('0') << key << ".ctx";
+    return path.str();
+}
+
+bool TextureCache::load(uint64_t key, int width, int height, MappedTexture& texture) const {
+    if (!texture.open(pathFor(key))) {
+        return false;
+    }
+
+    // Cabeçalho: magic, formato, reservado, largura, altura, chave, bytes de pixels
+    const unsigned char* header = texture.getData();
+    uint64_t pixelBytes = (uint64_t)width * height * 3;
+    bool valid = texture.getSize() == HEADER_SIZE + pixelBytes &&
+                 std::equal(CACHE_MAGIC, CACHE_MAGIC + 4, header) &&
+                 readBytes(header + 4, 2) == CACHE_FORMAT &&
+                 readBytes(header + 8, 4) == (uint64_t)width &&
+                 readBytes(header + 12, 4) == (uint64_t)height &&
+                 readBytes(header + 16, 8) == key &&
+                 readBytes(header + 24, 8) == pixelBytes;
+    if (!valid) {
+        std::cout << "Cache de textura inválido, gerando de novo: " << pathFor(key) << std::endl;
+        texture.close();
+        return false;
+    }
+
+    texture.setDimensions(width, height);
+    return true;
+}
+
+bool TextureCache::store(uint64_t key, const TextureImage& image) const {
+#ifdef _WIN32
+    _mkdir(directory.c_str());
+#else
+    mkdir(directory.c_str(), 0755);
+#endif
+
+    std::vector<unsigned char> header;
+    header.insert(header.end(), CACHE_MAGIC, CACHE_MAGIC + 4);
+    writeBytes(header, CACHE_FORMAT, 2);
+    writeBytes(header, 0, 2);
+    writeBytes(header, (uint32_t)image.width, 4);
+    writeBytes(header, (uint32_t)image.height, 4);
+    writeBytes(header, key, 8);
+    writeBytes(header, image.pixels.size(), 8);
+
+    std::string path = pathFor(key);
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            std::cout << "Não foi possível gravar o cache de textura em " << directory << std::endl;
+            return false;
+        }
+        file.write((const char*)header.data(), header.size());
+        file.write((const char*)image.pixels.data(), image.pixels.size());
+        if (!file) {
+            file.close();
+            std::remove(temporary.c_str());
+            return false;
+        }
+    }
+
+    // No Windows o rename não substitui um arquivo existente
+    std::remove(path.c_str());
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
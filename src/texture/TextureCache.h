@@ -0,0 +1,69 @@
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+struct TextureImage;
+
+// Arquivo do cache mapeado em memória, somente leitura (desmapeado no destrutor)
+class MappedTexture {
+private:
+    const unsigned char* mapping;
+    size_t mappedSize;
+    int width;
+    int height;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+
+public:
+    MappedTexture();
+    ~MappedTexture();
+
+    MappedTexture(const MappedTexture&) = delete;
+    MappedTexture& operator=(const MappedTexture&) = delete;
+
+    // Mapeia o arquivo inteiro; false se não existe ou não pôde ser mapeado
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return mapping != nullptr; }
+    const unsigned char* getData() const { return mapping; }
+    size_t getSize() const { return mappedSize; }
+
+    // Preenchidos por TextureCache::load depois de validar o cabeçalho
+    const unsigned char* getPixels() const;
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    void setDimensions(int newWidth, int newHeight) { width = newWidth; height = newHeight; }
+};
+
+// Cache em disco das texturas procedurais. Cada textura vira um arquivo
+// <chave>.ctx no diretório do cache, com um cabeçalho de 32 bytes seguido dos
+// pixels RGB crus, do jeito que vão para o glTexImage2D. A chave é um hash
+// de tudo que determina os pixels (nome, tamanho, seed e versão do gerador),
+// então uma entrada nunca fica desatualizada: muda a entrada, muda o arquivo.
+class TextureCache {
+public:
+    static const size_t HEADER_SIZE = 32;
+
+private:
+    std::string directory;
+
+public:
+    explicit TextureCache(const std::string& directory);
+
+    static uint64_t makeKey(const std::string& name, int width, int height, uint64_t seed);
+    std::string pathFor(uint64_t key) const;
+
+    // Mapeia a entrada e confere o cabeçalho (formato, chave, tamanho)
+    bool load(uint64_t key, int width, int height, MappedTexture& texture) const;
+    // Grava a imagem (num arquivo temporário renomeado no fim, para que uma
+    // gravação interrompida nunca deixe uma entrada pela metade)
+    bool store(uint64_t key, const TextureImage& image) const;
+};
+
+#endif // TEXTURE_CACHE_H
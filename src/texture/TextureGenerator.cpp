@@ -0,0 +1,272 @@
+#include "TextureGenerator.h"
+#include "TextureKernel.h"
+#include "../utils/Random.h"
+#include "../utils/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Gerador da faixa: cada uma tem seu fluxo, independente das demais
+static Random tileRandom(uint64_t seed, int tile) {
+    return Random(Random::deriveSeed(seed, (uint64_t)tile));
+}
+
+static void galaxyRows(uint64_t seed, TextureImage& image, int tile, int firstRow, int lastRow) {
+    int width = image.width;
+    Random random = tileRandom(seed, tile);
+    std::vector<float> noise(width);
+
+    for (int y = firstRow; y < lastRow; y++) {
+        // Ruído para variação, sorteado na ordem dos pixels
+        for (int x = 0; x < width; x++) {
+            noise[x] = random.nextInt(100) / 100.0f * 0.3f;
+        }
+        TextureKernel::galaxyRow(image.pixels.data() + (size_t)y * width * 3, noise.data(), width, image.height, y);
+    }
+}
+
+// Desenha as estrelas sorteadas pela faixa source, escrevendo apenas nas
+// linhas [firstRow, lastRow) - o brilho de uma estrela pode cair na faixa
+// vizinha, que refaz o mesmo sorteio para desenhar a sua parte
+static void starsFromTile(uint64_t seed, TextureImage& image, int source, int firstRow, int lastRow) {
+    int width = image.width;
+    int height = image.height;
+    unsigned char* data = image.pixels.data();
+    Random random = tileRandom(seed, source);
+
+    int sourceFirst = source * TextureGenerator::TILE_ROWS;
+    int sourceRows = std::min(TextureGenerator::TILE_ROWS, height - sourceFirst);
+
+    // Densidade de estrelas
+    int numStars = (width * sourceRows) / 1000;
+
+    for (int i = 0; i < numStars; i++) {
+        int x = random.nextInt(width);
+        int y = sourceFirst + random.nextInt(sourceRows);
+
+        // Intensidade aleatória da estrela
+        float intensity = 0.5f + random.nextInt(100) / 200.0f;
+        unsigned char starColor = (unsigned char)(255 * intensity);
+
+        if (y >= firstRow && y < lastRow) {
+            int index = (y * width + x) * 3;
+            data[index] = starColor;     // R
+            data[index + 1] = starColor; // G
+            data[index + 2] = starColor; // B
+        }
+
+        // Adicionar brilho ao redor (opcional)
+        if (random.nextInt(10) == 0) { // 10% das estrelas têm brilho
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    int nx = x + dx;
+                    int ny = y + dy;
+                    if (nx >= 0 && nx < width && ny >= firstRow && ny < lastRow) {
+                        int nindex = (ny * width + nx) * 3;
+                        unsigned char glow = (unsigned char)(100 * intensity);
+                        data[nindex] = std::max(data[nindex], glow);
+                        data[nindex + 1] = std::max(data[nindex + 1], glow);
+                        data[nindex + 2] = std::max(data[nindex + 2], glow);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void starFieldRows(uint64_t seed, TextureImage& image, int tile, int firstRow, int lastRow) {
+    // Preencher com preto
+    memset(image.pixels.data() + firstRow * image.width * 3, 0, (lastRow - firstRow) * image.width * 3);
+
+    // Estrelas da faixa anterior, da própria e da seguinte, sempre nessa ordem
+    int tiles = TextureGenerator::tileCount(image.height);
+    for (int source = tile - 1; source <= tile + 1; source++) {
+        if (source >= 0 && source < tiles) {
+            starsFromTile(seed, image, source, firstRow, lastRow);
+        }
+    }
+}
+
+static void nebulaRows(uint64_t seed, TextureImage& image, int tile, int firstRow, int lastRow) {
+    int width = image.width;
+    Random random = tileRandom(seed, tile);
+    std::vector<float> noise(width);
+
+    for (int y = firstRow; y < lastRow; y++) {
+        for (int x = 0; x < width; x++) {
+            noise[x] = random.nextInt(100) / 500.0f;
+        }
+        TextureKernel::nebulaRow(image.pixels.data() + (size_t)y * width * 3, noise.data(), width, image.height, y);
+    }
+}
+
+static void rocketRows(uint64_t seed, TextureImage& image, int tile, int firstRow, int lastRow) {
+    int width = image.width;
+    unsigned char* data = image.pixels.data();
+    Random random = tileRandom(seed, tile);
+
+    for (int y = firstRow; y < lastRow; y++) {
+        for (int x = 0; x < width; x++) {
+            int index = (y * width + x) * 3;
+
+            // Base metálica cinza
+            unsigned char baseR = 130;
+            unsigned char baseG = 135;
+            unsigned char baseB = 150;
+
+            // Adicionar padrão de placas metálicas hexagonais
+            int plateSize = 24;
+            int plateX = x / plateSize;
+            int plateY = y / plateSize;
+
+            // Padrão hexagonal
+            bool isHexEdge = ((x % plateSize) < 2) || ((y % plateSize) < 2) ||
+                           ((x % plateSize) > plateSize - 3) || ((y % plateSize) > plateSize - 3);
+
+            if (isHexEdge) {
+                // Bordas das placas - mais escuras
+                baseR = std::max(80, (int)baseR - 40);
+                baseG = std::max(80, (int)baseG - 40);
+                baseB = std::max(90, (int)baseB - 40);
+            } else {
+                // Centro das placas - variação aleatória
+                float plateVariation = ((plateX + plateY) % 4) * 0.08f;
+                baseR = (unsigned char)(baseR * (1.0f + plateVariation));
+                baseG = (unsigned char)(baseG * (1.0f + plateVariation));
+                baseB = (unsigned char)(baseB * (1.0f + plateVariation));
+            }
+
+            // Adicionar detalhes de superfície metálica com ruído
+            float metalNoise = random.nextInt(30) / 150.0f - 0.1f;
+
+            // Linhas de soldas horizontais principais
+            if (y % 48 < 3) {
+                baseR = std::min(255, (int)baseR + 45);
+                baseG = std::min(255, (int)baseG + 35);
+                baseB = std::min(255, (int)baseB + 25);
+            }
+
+            // Linhas de soldas verticais secundárias
+            if (x % 96 < 2) {
+                baseR = std::min(255, (int)baseR + 35);
+                baseG = std::min(255, (int)baseG + 30);
+                baseB = std::min(255, (int)baseB + 20);
+            }
+
+            // Sistema de rebites mais detalhado
+            int rivetSpacing = 32;
+            int rivetX = x % rivetSpacing;
+            int rivetY = y % rivetSpacing;
+            float rivetDist = sqrt((rivetX - rivetSpacing/2) * (rivetX - rivetSpacing/2) +
+                                 (rivetY - rivetSpacing/2) * (rivetY - rivetSpacing/2));
+
+            if (rivetDist < 3) {
+                // Centro do rebite - muito brilhante
+                baseR = 200;
+                baseG = 205;
+                baseB = 220;
+            } else if (rivetDist < 5) {
+                // Anel do rebite - brilhante
+                baseR = std::min(255, (int)baseR + 50);
+                baseG = std::min(255, (int)baseG + 50);
+                baseB = std::min(255, (int)baseB + 60);
+            } else if (rivetDist < 7) {
+                // Sombra ao redor do rebite
+                baseR = std::max(50, (int)baseR - 25);
+                baseG = std::max(50, (int)baseG - 25);
+                baseB = std::max(60, (int)baseB - 25);
+            }
+
+            // Adicionar arranhões e marcas de desgaste
+            if ((x + y * 7) % 150 < 2) {
+                // Arranhões brilhantes
+                baseR = std::min(255, (int)baseR + 60);
+                baseG = std::min(255, (int)baseG + 55);
+                baseB = std::min(255, (int)baseB + 70);
+            }
+
+            // Manchas de oxidação ocasionais
+            if ((x * 3 + y * 5) % 200 < 3) {
+                baseR = std::max(100, (int)baseR - 20);
+                baseG = std::max(90, (int)baseG - 30);
+                baseB = std::max(80, (int)baseB - 40);
+            }
+
+            // Padrão de identificação da nave (listras diagonais)
+            if ((x + y) % 64 < 4 && (x - y) % 64 < 4) {
+                baseR = std::min(255, (int)baseR + 30);
+                baseG = std::min(255, (int)baseG + 40);
+                baseB = std::min(255, (int)baseB + 60);
+            }
+
+            // Aplicar variações finais
+            baseR = std::max(0, std::min(255, (int)(baseR * (1.0f + metalNoise))));
+            baseG = std::max(0, std::min(255, (int)(baseG * (1.0f + metalNoise))));
+            baseB = std::max(0, std::min(255, (int)(baseB * (1.0f + metalNoise))));
+
+            data[index] = baseR;
+            data[index + 1] = baseG;
+            data[index + 2] = baseB;
+        }
+    }
+}
+
+void TextureGenerator::allocate(TextureImage& image, int width, int height) {
+    image.width = width;
+    image.height = height;
+    image.pixels.assign((size_t)width * height * 3, 0);
+}
+
+void TextureGenerator::generateTile(ProceduralTexture kind, uint64_t seed, TextureImage& image, int tile) {
+    int firstRow = tile * TILE_ROWS;
+    int lastRow = std::min(firstRow + TILE_ROWS, image.height);
+
+    switch (kind) {
+        case PROCEDURAL_GALAXY:    galaxyRows(seed, image, tile, firstRow, lastRow); break;
+        case PROCEDURAL_STARFIELD: starFieldRows(seed, image, tile, firstRow, lastRow); break;
+        case PROCEDURAL_NEBULA:    nebulaRows(seed, image, tile, firstRow, lastRow); break;
+        case PROCEDURAL_ROCKET:    rocketRows(seed, image, tile, firstRow, lastRow); break;
+    }
+}
+
+void TextureGenerator::generate(ProceduralTexture kind, uint64_t seed, TextureImage& image) {
+    for (int tile = 0; tile < tileCount(image.height); tile++) {
+        generateTile(kind, seed, image, tile);
+    }
+}
+
+void TextureGenerator::submit(ThreadPool& pool, ProceduralTexture kind, uint64_t seed, TextureImage& image) {
+    TextureImage* target = &image;
+    for (int tile = 0; tile < tileCount(image.height); tile++) {
+        pool.submit([kind, seed, target, tile] {
+            generateTile(kind, seed, *target, tile);
+        });
+    }
+}
+
+void TextureGenerator::downsample(const unsigned char* pixels, int width, int height, TextureImage& half) {
+    allocate(half, std::max(1, width / 2), std::max(1, height / 2));
+
+    for (int y = 0; y < half.height; y++) {
+        const unsigned char* row0 = pixels + (size_t)std::min(y * 2, height - 1) * width * 3;
+        const unsigned char* row1 = pixels + (size_t)std::min(y * 2 + 1, height - 1) * width * 3;
+        unsigned char* out = half.pixels.data() + (size_t)y * half.width * 3;
+        for (int x = 0; x < half.width; x++) {
+            int x0 = std::min(x * 2, width - 1) * 3;
+            int x1 = std::min(x * 2 + 1, width - 1) * 3;
+            for (int c = 0; c < 3; c++) {
+                out[x * 3 + c] = (unsigned char)((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+            }
+        }
+    }
+}
+
+const char* TextureGenerator::getName(ProceduralTexture kind) {
+    switch (kind) {
+        case PROCEDURAL_GALAXY:    return "galáxia";
+        case PROCEDURAL_STARFIELD: return "campo de estrelas";
+        case PROCEDURAL_NEBULA:    return "nebulosa";
+        case PROCEDURAL_ROCKET:    return "foguete espacial";
+        default:                   return "?";
+    }
+}
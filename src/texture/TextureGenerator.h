@@ -0,0 +1,61 @@
+#ifndef TEXTURE_GENERATOR_H
+#define TEXTURE_GENERATOR_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ThreadPool;
+
+// Texturas procedurais do jogo
+enum ProceduralTexture {
+    PROCEDURAL_GALAXY,
+    PROCEDURAL_STARFIELD,
+    PROCEDURAL_NEBULA,
+    PROCEDURAL_ROCKET
+};
+
+// Imagem RGB (3 bytes por pixel) gerada em memória, pronta para o upload
+struct TextureImage {
+    int width;
+    int height;
+    std::vector<unsigned char> pixels;
+
+    TextureImage() : width(0), height(0) {}
+};
+
+// Geração dos pixels das texturas procedurais, sem OpenGL. A imagem é
+// dividida em faixas de TILE_ROWS linhas e cada faixa tem seu próprio
+// gerador aleatório (derivado da seed da textura e do índice da faixa),
+// então as faixas podem ser geradas em qualquer ordem e em qualquer thread
+// e o resultado é sempre o mesmo para a mesma seed.
+class TextureGenerator {
+public:
+    static const int TILE_ROWS = 32;
+    // Versão das fórmulas: incrementar sempre que os pixels gerados mudarem
+    // (faz parte da chave do cache em disco)
+    static const uint32_t VERSION = 1;
+
+    static int tileCount(int height) { return (height + TILE_ROWS - 1) / TILE_ROWS; }
+
+    // Prepara a imagem (tamanho e memória) antes de gerar as faixas
+    static void allocate(TextureImage& image, int width, int height);
+
+    // Gera uma faixa (escreve apenas as linhas dela)
+    static void generateTile(ProceduralTexture kind, uint64_t seed, TextureImage& image, int tile);
+
+    // Gera a imagem inteira na thread atual
+    static void generate(ProceduralTexture kind, uint64_t seed, TextureImage& image);
+
+    // Envia uma tarefa por faixa ao pool (a imagem já deve estar alocada);
+    // o chamador espera com pool.wait()
+    static void submit(ThreadPool& pool, ProceduralTexture kind, uint64_t seed, TextureImage& image);
+
+    // Próximo nível de mipmap: média de cada bloco 2x2 (caixa), com metade
+    // do tamanho (mínimo 1); em tamanhos ímpares a última linha/coluna é repetida
+    static void downsample(const unsigned char* pixels, int width, int height, TextureImage& half);
+
+    static const char* getName(ProceduralTexture kind);
+};
+
+#endif // TEXTURE_GENERATOR_H
@@ -0,0 +1,453 @@
+#include "TextureKernel.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define TEXTURE_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+static const float PI = 3.14159265358979f;
+static const float HALF_PI = 1.57079632679490f;
+
+// Seno: mesma redução de faixa e mesmos coeficientes do ObstacleKernel
+static const float INV_PI = 0.318309886183790671538f;
+static const float PI_HI = 3.140625f;
+static const float PI_LO = 9.67653589793e-4f;
+static const float S3 = -1.66666571e-1f;
+static const float S5 = 8.33301729e-3f;
+static const float S7 = -1.98066152e-4f;
+static const float S9 = 2.60005486e-6f;
+
+// atan(a) = a * (A1 + a^2 * (A3 + ... + a^2 * A11)), a em [0, 1]
+// (erro de aproximação < 3e-6 rad nesse intervalo)
+static const float A1 = 0.99997726f;
+static const float A3 = -0.33262347f;
+static const float A5 = 0.19354346f;
+static const float A7 = -0.11643287f;
+static const float A9 = 0.05265332f;
+static const float A11 = -0.01172120f;
+
+// Evita 0/0 no centro exato (atan2(0, 0) = 0)
+static const float TINY = 1e-30f;
+
+// Pixels por iteração dos backends vetoriais (dois vetores)
+static const int MAX_BLOCK = 16;
+
+std::atomic<KernelBackend> TextureKernel::backend(KERNEL_AUTO);
+
+static float withSignOf(float value, uint32_t signBit) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    bits ^= signBit;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static uint32_t signBitOf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits & 0x80000000u;
+}
+
+float TextureKernel::sinApprox(float x) {
+    // nearbyint arredonda para o par mais próximo, como cvtps2dq
+    int32_t k = (int32_t)std::nearbyint(x * INV_PI);
+    float kf = (float)k;
+    float r = (x - kf * PI_HI) - kf * PI_LO;
+    float r2 = r * r;
+    float p = S9;
+    p = p * r2 + S7;
+    p = p * r2 + S5;
+    p = p * r2 + S3;
+    float s = r + (r * r2) * p;
+
+    // sin(x) = (-1)^k * sin(r)
+    return withSignOf(s, (uint32_t)k << 31);
+}
+
+float TextureKernel::cosApprox(float x) {
+    return sinApprox(x + HALF_PI);
+}
+
+float TextureKernel::atan2Approx(float y, float x) {
+    float ax = std::fabs(x);
+    float ay = std::fabs(y);
+    float a = std::min(ax, ay) / std::max(std::max(ax, ay), TINY);
+    float s = a * a;
+    float p = A11;
+    p = p * s + A9;
+    p = p * s + A7;
+    p = p * s + A5;
+    p = p * s + A3;
+    p = p * s + A1;
+    float r = a * p;
+
+    // Desfaz a redução para o primeiro octante e aplica o sinal de y
+    if (ay > ax) r = HALF_PI - r;
+    if (signBitOf(x)) r = PI - r;
+    return withSignOf(r, signBitOf(y));
+}
+
+static float clamp01(float value) {
+    return std::max(0.0f, std::min(1.0f, value));
+}
+
+// Pixels [begin, width) da linha da galáxia, um a um
+static void galaxyScalar(unsigned char* row, const float* noise, int begin, int width, int height, int y) {
+    float centerX = width / 2.0f;
+    float centerY = height / 2.0f;
+    float maxRadius = std::min(centerX, centerY);
+    float dy = y - centerY;
+
+    for (int x = begin; x < width; x++) {
+        float dx = x - centerX;
+        float distance = std::sqrt(dx * dx + dy * dy);
+        float normalizedDistance = distance / maxRadius;
+
+        float angle = TextureKernel::atan2Approx(dy, dx);
+        float spiral = TextureKernel::sinApprox(angle * 3.0f + distance * 0.1f) * 0.5f + 0.5f;
+
+        float intensity = clamp01(1.0f - normalizedDistance);
+        intensity = clamp01(intensity + noise[x]);
+        intensity *= spiral * 0.7f + 0.3f;
+
+        unsigned char* pixel = row + x * 3;
+        if (normalizedDistance < 0.3f) {
+            // Centro - branco/amarelo
+            pixel[0] = (unsigned char)(255 * intensity);
+            pixel[1] = (unsigned char)(240 * intensity);
+            pixel[2] = (unsigned char)(200 * intensity);
+        } else if (normalizedDistance < 0.7f) {
+            // Meio - azul/ciano
+            pixel[0] = (unsigned char)(100 * intensity);
+            pixel[1] = (unsigned char)(150 * intensity);
+            pixel[2] = (unsigned char)(255 * intensity);
+        } else {
+            // Borda - roxo/escuro
+            pixel[0] = (unsigned char)(80 * intensity);
+            pixel[1] = (unsigned char)(50 * intensity);
+            pixel[2] = (unsigned char)(120 * intensity);
+        }
+    }
+}
+
+static void nebulaScalar(unsigned char* row, const float* noise, int begin, int width, int height, int y) {
+    // Os cossenos dependem só da linha
+    float ny = (float)y / height * 4.0f;
+    float cos1 = TextureKernel::cosApprox(ny * 3.14159f);
+    float cos2 = TextureKernel::cosApprox(ny * 6.28318f);
+
+    for (int x = begin; x < width; x++) {
+        float nx = (float)x / width * 4.0f;
+        float noise1 = TextureKernel::sinApprox(nx * 3.14159f) * cos1;
+        float noise2 = TextureKernel::sinApprox(nx * 6.28318f) * cos2 * 0.5f;
+
+        float intensity = clamp01((noise1 + noise2 + noise[x]) * 0.5f + 0.5f);
+
+        unsigned char* pixel = row + x * 3;
+        pixel[0] = (unsigned char)(120 * intensity + 30);
+        pixel[1] = (unsigned char)(80 * intensity + 20);
+        pixel[2] = (unsigned char)(160 * intensity + 40);
+    }
+}
+
+// Intercala os canais calculados pelos vetores em RGB
+static void storeRGB(unsigned char* pixels, const int32_t* red, const int32_t* green, const int32_t* blue, int count) {
+    for (int i = 0; i < count; i++) {
+        pixels[i * 3] = (unsigned char)red[i];
+        pixels[i * 3 + 1] = (unsigned char)green[i];
+        pixels[i * 3 + 2] = (unsigned char)blue[i];
+    }
+}
+
+#ifdef TEXTURE_KERNEL_X86
+
+__attribute__((target("sse2")))
+static inline __m128 select4(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+__attribute__((target("sse2")))
+static inline __m128 clamp4(__m128 value) {
+    return _mm_max_ps(_mm_set1_ps(0.0f), _mm_min_ps(_mm_set1_ps(1.0f), value));
+}
+
+__attribute__((target("sse2")))
+static inline __m128 sin4(__m128 x) {
+    __m128i k = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(INV_PI)));
+    __m128 kf = _mm_cvtepi32_ps(k);
+    __m128 r = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(kf, _mm_set1_ps(PI_HI))), _mm_mul_ps(kf, _mm_set1_ps(PI_LO)));
+    __m128 r2 = _mm_mul_ps(r, r);
+    __m128 p = _mm_set1_ps(S9);
+    p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(S7));
+    p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(S5));
+    p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(S3));
+    __m128 s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), p));
+    return _mm_xor_ps(s, _mm_castsi128_ps(_mm_slli_epi32(k, 31)));
+}
+
+__attribute__((target("sse2")))
+static inline __m128 atan24(__m128 y, __m128 x) {
+    const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32((int)0x80000000u));
+    __m128 ax = _mm_andnot_ps(signMask, x);
+    __m128 ay = _mm_andnot_ps(signMask, y);
+    __m128 a = _mm_div_ps(_mm_min_ps(ax, ay), _mm_max_ps(_mm_max_ps(ax, ay), _mm_set1_ps(TINY)));
+    __m128 s = _mm_mul_ps(a, a);
+    __m128 p = _mm_set1_ps(A11);
+    p = _mm_add_ps(_mm_mul_ps(p, s), _mm_set1_ps(A9));
+    p = _mm_add_ps(_mm_mul_ps(p, s), _mm_set1_ps(A7));
+    p = _mm_add_ps(_mm_mul_ps(p, s), _mm_set1_ps(A5));
+    p = _mm_add_ps(_mm_mul_ps(p, s), _mm_set1_ps(A3));
+    p = _mm_add_ps(_mm_mul_ps(p, s), _mm_set1_ps(A1));
+    __m128 r = _mm_mul_ps(a, p);
+
+    r = select4(_mm_cmpgt_ps(ay, ax), _mm_sub_ps(_mm_set1_ps(HALF_PI), r), r);
+    __m128 xNegative = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31));
+    r = select4(xNegative, _mm_sub_ps(_mm_set1_ps(PI), r), r);
+    return _mm_xor_ps(r, _mm_and_ps(signMask, y));
+}
+
+__attribute__((target("sse2")))
+static inline void galaxy4(__m128 xf, __m128 centerX, __m128 dy, __m128 maxRadius, const float* noise,
+                           int32_t* red, int32_t* green, int32_t* blue) {
+    __m128 dx = _mm_sub_ps(xf, centerX);
+    __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+    __m128 normalizedDistance = _mm_div_ps(distance, maxRadius);
+
+    __m128 angle = atan24(dy, dx);
+    __m128 spiral = sin4(_mm_add_ps(_mm_mul_ps(angle, _mm_set1_ps(3.0f)), _mm_mul_ps(distance, _mm_set1_ps(0.1f))));
+    spiral = _mm_add_ps(_mm_mul_ps(spiral, _mm_set1_ps(0.5f)), _mm_set1_ps(0.5f));
+
+    __m128 intensity = clamp4(_mm_sub_ps(_mm_set1_ps(1.0f), normalizedDistance));
+    intensity = clamp4(_mm_add_ps(intensity, _mm_loadu_ps(noise)));
+    intensity = _mm_mul_ps(intensity, _mm_add_ps(_mm_mul_ps(spiral, _mm_set1_ps(0.7f)), _mm_set1_ps(0.3f)));
+
+    __m128 center = _mm_cmplt_ps(normalizedDistance, _mm_set1_ps(0.3f));
+    __m128 middle = _mm_cmplt_ps(normalizedDistance, _mm_set1_ps(0.7f));
+    __m128 colorR = select4(center, _mm_set1_ps(255.0f), select4(middle, _mm_set1_ps(100.0f), _mm_set1_ps(80.0f)));
+    __m128 colorG = select4(center, _mm_set1_ps(240.0f), select4(middle, _mm_set1_ps(150.0f), _mm_set1_ps(50.0f)));
+    __m128 colorB = select4(center, _mm_set1_ps(200.0f), select4(middle, _mm_set1_ps(255.0f), _mm_set1_ps(120.0f)));
+
+    _mm_storeu_si128((__m128i*)red, _mm_cvttps_epi32(_mm_mul_ps(colorR, intensity)));
+    _mm_storeu_si128((__m128i*)green, _mm_cvttps_epi32(_mm_mul_ps(colorG, intensity)));
+    _mm_storeu_si128((__m128i*)blue, _mm_cvttps_epi32(_mm_mul_ps(colorB, intensity)));
+}
+
+__attribute__((target("sse2")))
+static int galaxySSE2(unsigned char* row, const float* noise, int width, int height, int y) {
+    const __m128 centerX = _mm_set1_ps(width / 2.0f);
+    const __m128 maxRadius = _mm_set1_ps(std::min(width / 2.0f, height / 2.0f));
+    const __m128 dy = _mm_set1_ps(y - height / 2.0f);
+    const __m128 lanes = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    int32_t red[MAX_BLOCK], green[MAX_BLOCK], blue[MAX_BLOCK];
+
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        __m128 xf = _mm_add_ps(_mm_set1_ps((float)x), lanes);
+        galaxy4(xf, centerX, dy, maxRadius, noise + x, red, green, blue);
+        galaxy4(_mm_add_ps(xf, _mm_set1_ps(4.0f)), centerX, dy, maxRadius, noise + x + 4, red + 4, green + 4, blue + 4);
+        storeRGB(row + x * 3, red, green, blue, 8);
+    }
+    return x;
+}
+
+__attribute__((target("sse2")))
+static inline void nebula4(__m128 xf, __m128 width, __m128 cos1, __m128 cos2, const float* noise,
+                           int32_t* red, int32_t* green, int32_t* blue) {
+    __m128 nx = _mm_mul_ps(_mm_div_ps(xf, width), _mm_set1_ps(4.0f));
+    __m128 noise1 = _mm_mul_ps(sin4(_mm_mul_ps(nx, _mm_set1_ps(3.14159f))), cos1);
+    __m128 noise2 = _mm_mul_ps(_mm_mul_ps(sin4(_mm_mul_ps(nx, _mm_set1_ps(6.28318f))), cos2), _mm_set1_ps(0.5f));
+
+    __m128 sum = _mm_add_ps(_mm_add_ps(noise1, noise2), _mm_loadu_ps(noise));
+    __m128 intensity = clamp4(_mm_add_ps(_mm_mul_ps(sum, _mm_set1_ps(0.5f)), _mm_set1_ps(0.5f)));
+
+    _mm_storeu_si128((__m128i*)red, _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(120.0f), intensity), _mm_set1_ps(30.0f))));
+    _mm_storeu_si128((__m128i*)green, _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(80.0f), intensity), _mm_set1_ps(20.0f))));
+    _mm_storeu_si128((__m128i*)blue, _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(160.0f), intensity), _mm_set1_ps(40.0f))));
+}
+
+__attribute__((target("sse2")))
+static int nebulaSSE2(unsigned char* row, const float* noise, int width, int height, int y) {
+    float ny = (float)y / height * 4.0f;
+    const __m128 cos1 = _mm_set1_ps(TextureKernel::cosApprox(ny * 3.14159f));
+    const __m128 cos2 = _mm_set1_ps(TextureKernel::cosApprox(ny * 6.28318f));
+    const __m128 widthF = _mm_set1_ps((float)width);
+    const __m128 lanes = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    int32_t red[MAX_BLOCK], green[MAX_BLOCK], blue[MAX_BLOCK];
+
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        __m128 xf = _mm_add_ps(_mm_set1_ps((float)x), lanes);
+        nebula4(xf, widthF, cos1, cos2, noise + x, red, green, blue);
+        nebula4(_mm_add_ps(xf, _mm_set1_ps(4.0f)), widthF, cos1, cos2, noise + x + 4, red + 4, green + 4, blue + 4);
+        storeRGB(row + x * 3, red, green, blue, 8);
+    }
+    return x;
+}
+
+// Sem FMA de propósito: mul + add separados mantêm o resultado igual ao escalar
+__attribute__((target("avx2")))
+static inline __m256 select8(__m256 mask, __m256 a, __m256 b) {
+    return _mm256_blendv_ps(b, a, mask);
+}
+
+__attribute__((target("avx2")))
+static inline __m256 clamp8(__m256 value) {
+    return _mm256_max_ps(_mm256_set1_ps(0.0f), _mm256_min_ps(_mm256_set1_ps(1.0f), value));
+}
+
+__attribute__((target("avx2")))
+static inline __m256 sin8(__m256 x) {
+    __m256i k = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(INV_PI)));
+    __m256 kf = _mm256_cvtepi32_ps(k);
+    __m256 r = _mm256_sub_ps(_mm256_sub_ps(x, _mm256_mul_ps(kf, _mm256_set1_ps(PI_HI))), _mm256_mul_ps(kf, _mm256_set1_ps(PI_LO)));
+    __m256 r2 = _mm256_mul_ps(r, r);
+    __m256 p = _mm256_set1_ps(S9);
+    p = _mm256_add_ps(_mm256_mul_ps(p, r2), _mm256_set1_ps(S7));
+    p = _mm256_add_ps(_mm256_mul_ps(p, r2), _mm256_set1_ps(S5));
+    p = _mm256_add_ps(_mm256_mul_ps(p, r2), _mm256_set1_ps(S3));
+    __m256 s = _mm256_add_ps(r, _mm256_mul_ps(_mm256_mul_ps(r, r2), p));
+    return _mm256_xor_ps(s, _mm256_castsi256_ps(_mm256_slli_epi32(k, 31)));
+}
+
+__attribute__((target("avx2")))
+static inline __m256 atan28(__m256 y, __m256 x) {
+    const __m256 signMask = _mm256_castsi256_ps(_mm256_set1_epi32((int)0x80000000u));
+    __m256 ax = _mm256_andnot_ps(signMask, x);
+    __m256 ay = _mm256_andnot_ps(signMask, y);
+    __m256 a = _mm256_div_ps(_mm256_min_ps(ax, ay), _mm256_max_ps(_mm256_max_ps(ax, ay), _mm256_set1_ps(TINY)));
+    __m256 s = _mm256_mul_ps(a, a);
+    __m256 p = _mm256_set1_ps(A11);
+    p = _mm256_add_ps(_mm256_mul_ps(p, s), _mm256_set1_ps(A9));
+    p = _mm256_add_ps(_mm256_mul_ps(p, s), _mm256_set1_ps(A7));
+    p = _mm256_add_ps(_mm256_mul_ps(p, s), _mm256_set1_ps(A5));
+    p = _mm256_add_ps(_mm256_mul_ps(p, s), _mm256_set1_ps(A3));
+    p = _mm256_add_ps(_mm256_mul_ps(p, s), _mm256_set1_ps(A1));
+    __m256 r = _mm256_mul_ps(a, p);
+
+    r = select8(_mm256_cmp_ps(ay, ax, _CMP_GT_OQ), _mm256_sub_ps(_mm256_set1_ps(HALF_PI), r), r);
+    // blendv olha só o bit de sinal da máscara: o próprio x serve
+    r = select8(x, _mm256_sub_ps(_mm256_set1_ps(PI), r), r);
+    return _mm256_xor_ps(r, _mm256_and_ps(signMask, y));
+}
+
+__attribute__((target("avx2")))
+static inline void galaxy8(__m256 xf, __m256 centerX, __m256 dy, __m256 maxRadius, const float* noise,
+                           int32_t* red, int32_t* green, int32_t* blue) {
+    __m256 dx = _mm256_sub_ps(xf, centerX);
+    __m256 distance = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)));
+    __m256 normalizedDistance = _mm256_div_ps(distance, maxRadius);
+
+    __m256 angle = atan28(dy, dx);
+    __m256 spiral = sin8(_mm256_add_ps(_mm256_mul_ps(angle, _mm256_set1_ps(3.0f)), _mm256_mul_ps(distance, _mm256_set1_ps(0.1f))));
+    spiral = _mm256_add_ps(_mm256_mul_ps(spiral, _mm256_set1_ps(0.5f)), _mm256_set1_ps(0.5f));
+
+    __m256 intensity = clamp8(_mm256_sub_ps(_mm256_set1_ps(1.0f), normalizedDistance));
+    intensity = clamp8(_mm256_add_ps(intensity, _mm256_loadu_ps(noise)));
+    intensity = _mm256_mul_ps(intensity, _mm256_add_ps(_mm256_mul_ps(spiral, _mm256_set1_ps(0.7f)), _mm256_set1_ps(0.3f)));
+
+    __m256 center = _mm256_cmp_ps(normalizedDistance, _mm256_set1_ps(0.3f), _CMP_LT_OQ);
+    __m256 middle = _mm256_cmp_ps(normalizedDistance, _mm256_set1_ps(0.7f), _CMP_LT_OQ);
+    __m256 colorR = select8(center, _mm256_set1_ps(255.0f), select8(middle, _mm256_set1_ps(100.0f), _mm256_set1_ps(80.0f)));
+    __m256 colorG = select8(center, _mm256_set1_ps(240.0f), select8(middle, _mm256_set1_ps(150.0f), _mm256_set1_ps(50.0f)));
+    __m256 colorB = select8(center, _mm256_set1_ps(200.0f), select8(middle, _mm256_set1_ps(255.0f), _mm256_set1_ps(120.0f)));
+
+    _mm256_storeu_si256((__m256i*)red, _mm256_cvttps_epi32(_mm256_mul_ps(colorR, intensity)));
+    _mm256_storeu_si256((__m256i*)green, _mm256_cvttps_epi32(_mm256_mul_ps(colorG, intensity)));
+    _mm256_storeu_si256((__m256i*)blue, _mm256_cvttps_epi32(_mm256_mul_ps(colorB, intensity)));
+}
+
+__attribute__((target("avx2")))
+static int galaxyAVX2(unsigned char* row, const float* noise, int width, int height, int y) {
+    const __m256 centerX = _mm256_set1_ps(width / 2.0f);
+    const __m256 maxRadius = _mm256_set1_ps(std::min(width / 2.0f, height / 2.0f));
+    const __m256 dy = _mm256_set1_ps(y - height / 2.0f);
+    const __m256 lanes = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+    int32_t red[MAX_BLOCK], green[MAX_BLOCK], blue[MAX_BLOCK];
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m256 xf = _mm256_add_ps(_mm256_set1_ps((float)x), lanes);
+        galaxy8(xf, centerX, dy, maxRadius, noise + x, red, green, blue);
+        galaxy8(_mm256_add_ps(xf, _mm256_set1_ps(8.0f)), centerX, dy, maxRadius, noise + x + 8, red + 8, green + 8, blue + 8);
+        storeRGB(row + x * 3, red, green, blue, 16);
+    }
+    return x;
+}
+
+__attribute__((target("avx2")))
+static inline void nebula8(__m256 xf, __m256 width, __m256 cos1, __m256 cos2, const float* noise,
+                           int32_t* red, int32_t* green, int32_t* blue) {
+    __m256 nx = _mm256_mul_ps(_mm256_div_ps(xf, width), _mm256_set1_ps(4.0f));
+    __m256 noise1 = _mm256_mul_ps(sin8(_mm256_mul_ps(nx, _mm256_set1_ps(3.14159f))), cos1);
+    __m256 noise2 = _mm256_mul_ps(_mm256_mul_ps(sin8(_mm256_mul_ps(nx, _mm256_set1_ps(6.28318f))), cos2), _mm256_set1_ps(0.5f));
+
+    __m256 sum = _mm256_add_ps(_mm256_add_ps(noise1, noise2), _mm256_loadu_ps(noise));
+    __m256 intensity = clamp8(_mm256_add_ps(_mm256_mul_ps(sum, _mm256_set1_ps(0.5f)), _mm256_set1_ps(0.5f)));
+
+    _mm256_storeu_si256((__m256i*)red, _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(120.0f), intensity), _mm256_set1_ps(30.0f))));
+    _mm256_storeu_si256((__m256i*)green, _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(80.0f), intensity), _mm256_set1_ps(20.0f))));
+    _mm256_storeu_si256((__m256i*)blue, _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(160.0f), intensity), _mm256_set1_ps(40.0f))));
+}
+
+__attribute__((target("avx2")))
+static int nebulaAVX2(unsigned char* row, const float* noise, int width, int height, int y) {
+    float ny = (float)y / height * 4.0f;
+    const __m256 cos1 = _mm256_set1_ps(TextureKernel::cosApprox(ny * 3.14159f));
+    const __m256 cos2 = _mm256_set1_ps(TextureKernel::cosApprox(ny * 6.28318f));
+    const __m256 widthF = _mm256_set1_ps((float)width);
+    const __m256 lanes = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+    int32_t red[MAX_BLOCK], green[MAX_BLOCK], blue[MAX_BLOCK];
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m256 xf = _mm256_add_ps(_mm256_set1_ps((float)x), lanes);
+        nebula8(xf, widthF, cos1, cos2, noise + x, red, green, blue);
+        nebula8(_mm256_add_ps(xf, _mm256_set1_ps(8.0f)), widthF, cos1, cos2, noise + x + 8, red + 8, green + 8, blue + 8);
+        storeRGB(row + x * 3, red, green, blue, 16);
+    }
+    return x;
+}
+
+#endif // TEXTURE_KERNEL_X86
+
+void TextureKernel::galaxyRow(unsigned char* row, const float* noise, int width, int height, int y) {
+    int done = 0;
+
+#ifdef TEXTURE_KERNEL_X86
+    switch (getBackend()) {
+        case KERNEL_AVX2: done = galaxyAVX2(row, noise, width, height, y); break;
+        case KERNEL_SSE2: done = galaxySSE2(row, noise, width, height, y); break;
+        default: break;
+    }
+#endif
+
+    // Resto que não preencheu um bloco inteiro (ou tudo, no backend escalar)
+    galaxyScalar(row, noise, done, width, height, y);
+}
+
+void TextureKernel::nebulaRow(unsigned char* row, const float* noise, int width, int height, int y) {
+    int done = 0;
+
+#ifdef TEXTURE_KERNEL_X86
+    switch (getBackend()) {
+        case KERNEL_AVX2: done = nebulaAVX2(row, noise, width, height, y); break;
+        case KERNEL_SSE2: done = nebulaSSE2(row, noise, width, height, y); break;
+        default: break;
+    }
+#endif
+
+    nebulaScalar(row, noise, done, width, height, y);
+}
+
+void TextureKernel::setBackend(KernelBackend newBackend) {
+    backend.store(ObstacleKernel::isSupported(newBackend) ? newBackend : KERNEL_SCALAR, std::memory_order_relaxed);
+}
+
+KernelBackend TextureKernel::getBackend() {
+    KernelBackend current = backend.load(std::memory_order_relaxed);
+    return current == KERNEL_AUTO ? ObstacleKernel::getDetectedBackend() : current;
+}
@@ -0,0 +1,36 @@
+#ifndef TEXTURE_KERNEL_H
+#define TEXTURE_KERNEL_H
+
+#include "../obstacle/ObstacleKernel.h"
+
+// Kernels por linha das texturas procedurais mais caras (galáxia e
+// nebulosa), com os mesmos backends do ObstacleKernel. O SSE2 faz 8 pixels
+// por iteração (dois vetores de 4) e o AVX2 faz 16 (dois vetores de 8).
+//
+// atan2, sin e cos são aproximações polinomiais calculadas com as mesmas
+// operações, na mesma ordem, em todos os backends (o escalar incluído), então
+// a imagem é idêntica bit a bit em qualquer CPU. A raiz quadrada e a divisão
+// são as instruções exatas (IEEE) - as aproximações rcp/rsqrt variam entre
+// fabricantes. Em relação a std::sin/std::atan2 os pixels diferem no máximo
+// em 1 nível (o erro vai para o truncamento em unsigned char).
+class TextureKernel {
+private:
+    static std::atomic<KernelBackend> backend;
+
+public:
+    // Aproximações escalares usadas por todos os backends
+    static float sinApprox(float x);
+    static float cosApprox(float x);
+    static float atan2Approx(float y, float x);
+
+    // Escreve width pixels RGB da linha y. noise[x] é o ruído já sorteado
+    // (no fluxo da faixa), na escala que cada fórmula soma à intensidade.
+    static void galaxyRow(unsigned char* row, const float* noise, int width, int height, int y);
+    static void nebulaRow(unsigned char* row, const float* noise, int width, int height, int y);
+
+    // Backend usado (KERNEL_AUTO usa o detectado pelo ObstacleKernel)
+    static void setBackend(KernelBackend newBackend);
+    static KernelBackend getBackend();
+};
+
+#endif // TEXTURE_KERNEL_H
@@ -0,0 +1,27 @@
+#include "FixedTimestep.h"
+
+FixedTimestep::FixedTimestep(int rate) {
+    accumulator = 0.0f;
+    stepSize = 1.0f / rate;
+    // Limitar o tempo de um quadro para evitar a "espiral da morte"
+    // quando um quadro demora demais (janela arrastada, breakpoint, etc.)
+    maxFrameTime = 0.25f;
+}
+
+int FixedTimestep::advance(float frameTime) {
+    if (frameTime > maxFrameTime) frameTime = maxFrameTime;
+    if (frameTime < 0.0f) frameTime = 0.0f;
+    
+    accumulator += frameTime;
+    
+    int ticks = 0;
+    while (accumulator >= stepSize) {
+        accumulator -= stepSize;
+        ticks++;
+    }
+    return ticks;
+}
+
+void FixedTimestep::reset() {
+    accumulator = 0.0f;
+}
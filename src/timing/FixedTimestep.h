@@ -0,0 +1,30 @@
+#ifndef FIXED_TIMESTEP_H
+#define FIXED_TIMESTEP_H
+
+// Acumulador de passo fixo: o tempo real de cada quadro é convertido em um
+// número inteiro de ticks de simulação, e o resto vira o fator de
+// interpolação usado na renderização.
+class FixedTimestep {
+private:
+    float accumulator;
+    float stepSize;
+    float maxFrameTime;
+    
+public:
+    // Frequência padrão da simulação
+    static const int DEFAULT_RATE = 120;
+    
+    FixedTimestep(int rate = DEFAULT_RATE);
+    
+    // Adiciona o tempo do quadro e retorna quantos ticks devem ser executados
+    int advance(float frameTime);
+    
+    // Descarta o tempo acumulado (ex.: ao pausar ou reiniciar)
+    void reset();
+    
+    // Fração do próximo tick já decorrida, em [0, 1)
+    float getAlpha() const { return accumulator / stepSize; }
+    float getStepSize() const { return stepSize; }
+};
+
+#endif // FIXED_TIMESTEP_H
@@ -0,0 +1,198 @@
+#include "FramePacer.h"
+#include <GL/glut.h>
+#include <GL/freeglut_ext.h>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <mmsystem.h>
+#endif
+
+// Limites da margem de espera ativa antes do prazo
+static const double MIN_SPIN_MARGIN = 0.0002;
+static const double MAX_SPIN_MARGIN = 0.004;
+// Cada sleep é curto para o GLUT continuar tratando eventos entre eles
+static const double MAX_SLEEP = 0.002;
+
+FramePacer::FramePacer() {
+    mode = PACING_FIXED;
+    targetRate = 60;
+    period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / targetRate));
+    spinMarginSeconds = 0.001;
+    fineTimerResolution = false;
+    reset();
+}
+
+FramePacer::~FramePacer() {
+#ifdef _WIN32
+    if (fineTimerResolution) {
+        timeEndPeriod(1);
+    }
+#endif
+}
+
+void FramePacer::configure(PacingMode newMode, int rate) {
+#ifdef _WIN32
+    // Sleep com resolução de 1 ms (o padrão do Windows é ~15 ms)
+    bool wantFine = (newMode == PACING_FIXED);
+    if (wantFine && !fineTimerResolution) timeBeginPeriod(1);
+    if (!wantFine && fineTimerResolution) timeEndPeriod(1);
+    fineTimerResolution = wantFine;
+#endif
+    mode = newMode;
+    if (rate > 0) {
+        targetRate = rate;
+        period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rate));
+    }
+    reset();
+}
+
+bool FramePacer::applySwapInterval(int interval) {
+#ifdef _WIN32
+    typedef BOOL (WINAPI *SwapIntervalProc)(int);
+    SwapIntervalProc swapInterval = (SwapIntervalProc)glutGetProcAddress("wglSwapIntervalEXT");
+    return swapInterval && swapInterval(interval);
+#else
+    typedef int (*SwapIntervalMesaProc)(unsigned int);
+    typedef int (*SwapIntervalSgiProc)(int);
+    SwapIntervalMesaProc swapMesa = (SwapIntervalMesaProc)glutGetProcAddress("glXSwapIntervalMESA");
+    if (swapMesa) {
+        return swapMesa((unsigned int)interval) == 0;
+    }
+    // A extensão SGI não aceita 0 (não desliga o vsync)
+    SwapIntervalSgiProc swapSgi = (SwapIntervalSgiProc)glutGetProcAddress("glXSwapIntervalSGI");
+    if (swapSgi && interval > 0) {
+        return swapSgi(interval) == 0;
+    }
+    return false;
+#endif
+}
+
+bool FramePacer::poll() {
+    if (mode != PACING_FIXED) return true;
+
+    Clock::time_point now = Clock::now();
+    if (!started) {
+        nextDeadline = now;
+        started = true;
+    }
+
+    if (now >= nextDeadline) {
+        // O próximo prazo é relativo ao anterior, não a agora; se o quadro
+        // atrasou mais de um período, ressincronizar em vez de compensar
+        nextDeadline += period;
+        if (nextDeadline < now) {
+            nextDeadline = now + period;
+        }
+        return true;
+    }
+
+    double remaining = std::chrono::duration<double>(nextDeadline - now).count();
+    if (remaining > spinMarginSeconds) {
+        double request = std::min(remaining - spinMarginSeconds, MAX_SLEEP);
+        std::this_thread::sleep_for(std::chrono::duration<double>(request));
+        double overshoot = std::chrono::duration<double>(Clock::now() - now).count() - request;
+
+        // A margem sobe logo com um sleep atrasado e desce devagar
+        if (overshoot > spinMarginSeconds) {
+            spinMarginSeconds = overshoot;
+        } else {
+            spinMarginSeconds = spinMarginSeconds * 0.95 + std::max(overshoot, 0.0) * 0.05;
+        }
+        spinMarginSeconds = std::max(MIN_SPIN_MARGIN, std::min(spinMarginSeconds, MAX_SPIN_MARGIN));
+    } else {
+        // Últimos instantes: espera ativa
+        std::this_thread::yield();
+    }
+    return false;
+}
+
+void FramePacer::beginFrame() {
+    Clock::time_point now = Clock::now();
+    if (lastFrameStart != Clock::time_point()) {
+        double seconds = std::chrono::duration<double>(now - lastFrameStart).count();
+        int bin = (int)(seconds * 1000.0 * BINS_PER_MS);
+        bins[std::min(bin, (int)BIN_COUNT)]++;
+        frames++;
+        totalSeconds += seconds;
+        if (seconds > maxSeconds) maxSeconds = seconds;
+    }
+    lastFrameStart = now;
+}
+
+void FramePacer::reset() {
+    started = false;
+    lastFrameStart = Clock::time_point();
+    for (int i = 0; i <= BIN_COUNT; i++) {
+        bins[i] = 0;
+    }
+    frames = 0;
+    totalSeconds = 0.0;
+    maxSeconds = 0.0;
+}
+
+// Percentil pelo histograma (limite superior da faixa; a faixa extra usa o máximo)
+double FramePacer::percentileMs(double fraction) const {
+    if (frames == 0) return 0.0;
+    long long target = (long long)(fraction * (frames - 1)) + 1;
+    long long seen = 0;
+    for (int i = 0; i < BIN_COUNT; i++) {
+        seen += bins[i];
+        if (seen >= target) {
+            return std::min((double)(i + 1) / BINS_PER_MS, maxSeconds * 1000.0);
+        }
+    }
+    return maxSeconds * 1000.0;
+}
+
+std::string FramePacer::describe() const {
+    std::stringstream text;
+    switch (mode) {
+        case PACING_VSYNC:    text << "vsync"; break;
+        case PACING_FIXED:    text << targetRate << " Hz (sleep + espera ativa)"; break;
+        case PACING_UNCAPPED: text << "sem limite"; break;
+    }
+    return text.str();
+}
+
+void FramePacer::printSummary() const {
+    std::cout << "=== Ritmo de quadros (" << describe() << ") ===" << std::endl;
+    if (frames == 0) {
+        std::cout << "Nenhum quadro medido" << std::endl;
+        return;
+    }
+
+    // Formata num stream local para não mudar a formatação do std::cout
+    double averageMs = totalSeconds / frames * 1000.0;
+    std::stringstream text;
+    text << std::fixed << std::setprecision(2)
+         << "Quadros: " << frames << ", média " << averageMs << " ms (" << 1000.0 / averageMs << " FPS)"
+         << ", p50 " << percentileMs(0.5) << " ms, p99 " << percentileMs(0.99)
+         << " ms, máx " << maxSeconds * 1000.0 << " ms";
+    std::cout << text.str() << std::endl;
+
+    // Histograma em faixas de 1 ms, só as linhas com amostras
+    const int BAR_WIDTH = 40;
+    long long rows[BIN_COUNT / BINS_PER_MS + 1] = {};
+    long long largest = 0;
+    for (int i = 0; i <= BIN_COUNT; i++) {
+        int row = i / BINS_PER_MS;
+        rows[row] += bins[i];
+        largest = std::max(largest, rows[row]);
+    }
+    for (int row = 0; row <= BIN_COUNT / BINS_PER_MS; row++) {
+        if (rows[row] == 0) continue;
+        std::stringstream label;
+        if (row < BIN_COUNT / BINS_PER_MS) {
+            label << std::setw(3) << row << "-" << std::setw(2) << row + 1 << " ms";
+        } else {
+            label << "  >= " << row << " ms";
+        }
+        int bar = (int)((rows[row] * BAR_WIDTH + largest - 1) / largest);
+        std::cout << "  " << label.str() << " | " << std::string(bar, '#') << " " << rows[row] << std::endl;
+    }
+}
@@ -0,0 +1,71 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <chrono>
+#include <string>
+
+// Como o loop principal escolhe o instante de cada quadro
+enum PacingMode {
+    PACING_VSYNC,       // Sem espera própria: o swap bloqueia até o retraço
+    PACING_FIXED,       // Taxa alvo: sleep adaptativo seguido de espera ativa
+    PACING_UNCAPPED     // Sem limite (benchmark)
+};
+
+// Marcapasso de quadros chamado pela função idle do GLUT. No modo de taxa
+// fixa os prazos avançam em passos exatos do período (sem acumular o atraso
+// de cada quadro); o sleep acorda um pouco antes do prazo, numa margem que
+// se ajusta ao erro observado do sleep, e o resto é espera ativa.
+//
+// Também mantém um histograma dos tempos entre quadros para o resumo
+// (p50/p99/máx) impresso ao sair.
+class FramePacer {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    // Histograma: faixas de 0,25 ms até 50 ms (acima disso, uma faixa extra)
+    static const int BINS_PER_MS = 4;
+    static const int BIN_COUNT = 50 * BINS_PER_MS;
+
+private:
+    PacingMode mode;
+    int targetRate;
+    Clock::duration period;
+    Clock::time_point nextDeadline;
+    Clock::time_point lastFrameStart;
+    bool started;
+    double spinMarginSeconds;   // Acordar do sleep este tempo antes do prazo
+    bool fineTimerResolution;   // Windows: timeBeginPeriod(1) ativo
+
+    long long bins[BIN_COUNT + 1];
+    long long frames;
+    double totalSeconds;
+    double maxSeconds;
+
+    double percentileMs(double fraction) const;
+
+public:
+    FramePacer();
+    ~FramePacer();
+
+    // targetRate só é usado no modo PACING_FIXED
+    void configure(PacingMode mode, int targetRate);
+    // Liga/desliga a sincronia vertical do contexto atual (1 ou 0). Retorna
+    // false se o driver não expõe a extensão de swap interval.
+    static bool applySwapInterval(int interval);
+
+    // Chamado na função idle: retorna true quando um quadro deve ser feito
+    // agora. Caso contrário espera um pouco (sem passar do prazo) e retorna
+    // false, devolvendo o controle ao GLUT para tratar teclado e janela.
+    bool poll();
+    // Marca o início do quadro (registra o intervalo no histograma)
+    void beginFrame();
+
+    void reset();
+    void printSummary() const;
+
+    PacingMode getMode() const { return mode; }
+    int getTargetRate() const { return targetRate; }
+    std::string describe() const;
+};
+
+#endif // FRAME_PACER_H
@@ -0,0 +1,34 @@
+#include "LatencyStats.h"
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+
+LatencyStats::LatencyStats(const std::string& name) : name(name) {
+}
+
+void LatencyStats::add(double seconds) {
+    samples.push_back((float)(seconds * 1000.0));
+}
+
+float LatencyStats::getPercentile(float fraction) const {
+    if (samples.empty()) return 0.0f;
+    std::vector<float> sorted(samples);
+    size_t index = (size_t)(fraction * (sorted.size() - 1) + 0.5f);
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted[index];
+}
+
+void LatencyStats::print() const {
+    if (samples.empty()) {
+        std::cout << name << ": sem amostras" << std::endl;
+        return;
+    }
+    // Formata num stream local para não mudar a formatação do std::cout
+    std::stringstream text;
+    text << std::fixed << std::setprecision(1)
+         << name << ": p50 " << getPercentile(0.5f) << " ms, p90 " << getPercentile(0.9f)
+         << " ms, p99 " << getPercentile(0.99f) << " ms, máx " << getPercentile(1.0f)
+         << " ms (" << samples.size() << " amostras)";
+    std::cout << text.str() << std::endl;
+}
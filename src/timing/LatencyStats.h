@@ -0,0 +1,28 @@
+#ifndef LATENCY_STATS_H
+#define LATENCY_STATS_H
+
+#include <string>
+#include <vector>
+
+// Amostras de latência com percentis (p50/p90/p99/máximo). Guarda as
+// amostras do período até o reset, como o PerfCounter.
+class LatencyStats {
+private:
+    std::string name;
+    std::vector<float> samples;   // Em milissegundos
+
+public:
+    LatencyStats(const std::string& name);
+
+    void add(double seconds);
+    void reset() { samples.clear(); }
+
+    int getSamples() const { return (int)samples.size(); }
+    // Percentil em milissegundos (fraction em [0, 1])
+    float getPercentile(float fraction) const;
+
+    // Imprime "nome: p50 / p90 / p99 / máx (amostras)"
+    void print() const;
+};
+
+#endif // LATENCY_STATS_H
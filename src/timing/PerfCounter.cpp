@@ -0,0 +1,39 @@
+#include "PerfCounter.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+
+PerfCounter::PerfCounter(const std::string& name) : name(name) {
+    reset();
+}
+
+void PerfCounter::begin() {
+    startTime = std::chrono::steady_clock::now();
+}
+
+void PerfCounter::end() {
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    totalSeconds += elapsed;
+    if (elapsed > maxSeconds) maxSeconds = elapsed;
+    samples++;
+}
+
+void PerfCounter::reset() {
+    totalSeconds = 0.0;
+    maxSeconds = 0.0;
+    samples = 0;
+}
+
+double PerfCounter::getAverageMicros() const {
+    if (samples == 0) return 0.0;
+    return totalSeconds / samples * 1e6;
+}
+
+void PerfCounter::print() const {
+    // Formata num stream local para não mudar a formatação do std::cout
+    std::stringstream text;
+    text << std::fixed << std::setprecision(1)
+         << name << ": média " << getAverageMicros() << " us, máx "
+         << getMaxMicros() << " us (" << samples << " amostras)";
+    std::cout << text.str() << std::endl;
+}
@@ -0,0 +1,32 @@
+#ifndef PERF_COUNTER_H
+#define PERF_COUNTER_H
+
+#include <chrono>
+#include <string>
+
+// Contador simples de custo (média e máximo) para medir trechos do loop
+class PerfCounter {
+private:
+    std::string name;
+    std::chrono::steady_clock::time_point startTime;
+    double totalSeconds;
+    double maxSeconds;
+    long long samples;
+    
+public:
+    PerfCounter(const std::string& name);
+    
+    void begin();
+    void end();
+    void reset();
+    
+    long long getSamples() const { return samples; }
+    double getAverageMicros() const;
+    double getMaxMicros() const { return maxSeconds * 1e6; }
+    double getTotalSeconds() const { return totalSeconds; }
+    
+    // Imprime "nome: média / máximo / amostras"
+    void print() const;
+};
+
+#endif // PERF_COUNTER_H
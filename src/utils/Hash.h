@@ -0,0 +1,38 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// Hash FNV-1a (32 e 64 bits), usado para checksums de estado e chaves
+namespace Hash {
+    const uint32_t FNV32_OFFSET = 0x811C9DC5u;
+    const uint64_t FNV64_OFFSET = 0xCBF29CE484222325ULL;
+    
+    inline uint32_t fnv1a32(uint32_t hash, const void* data, size_t size) {
+        const unsigned char* bytes = (const unsigned char*)data;
+        for (size_t i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= 0x01000193u;
+        }
+        return hash;
+    }
+    
+    inline uint64_t fnv1a64(uint64_t hash, const void* data, size_t size) {
+        const unsigned char* bytes = (const unsigned char*)data;
+        for (size_t i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= 0x100000001B3ULL;
+        }
+        return hash;
+    }
+    
+    // Combina um valor qualquer (bit a bit) ao hash de 32 bits
+    template <typename T>
+    inline uint32_t combine(uint32_t hash, const T& value) {
+        return fnv1a32(hash, &value, sizeof(T));
+    }
+}
+
+#endif // HASH_H
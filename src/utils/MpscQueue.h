@@ -0,0 +1,85 @@
+#ifndef MPSC_QUEUE_H
+#define MPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Fila circular sem locks com vários produtores e um único consumidor
+// (esquema de Vyukov: cada célula guarda um número de sequência que diz se
+// ela está livre para o produtor da volta atual ou pronta para o consumidor).
+// A capacidade é fixa e arredondada para potência de 2; push nunca aloca nem
+// bloqueia e retorna false com a fila cheia.
+template <typename T>
+class MpscQueue {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+
+    // Produtores e consumidor em linhas de cache separadas
+    char padding0[64];
+    std::atomic<size_t> tail;
+    char padding1[64];
+    size_t head;
+    char padding2[64];
+
+public:
+    explicit MpscQueue(size_t capacity) : tail(0), head(0) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        cells.reset(new Cell[size]);
+        mask = size - 1;
+        for (size_t i = 0; i < size; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    // Qualquer thread
+    bool push(const T& value) {
+        size_t position = tail.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[position & mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)sequence - (intptr_t)position;
+            if (diff == 0) {
+                // Célula livre nesta volta: reservá-la
+                if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // O consumidor ainda não liberou a célula: fila cheia
+                return false;
+            } else {
+                position = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Apenas a thread consumidora
+    bool pop(T& value) {
+        Cell& cell = cells[head & mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence != head + 1) {
+            return false;
+        }
+        value = cell.value;
+        cell.sequence.store(head + mask + 1, std::memory_order_release);
+        head++;
+        return true;
+    }
+
+    size_t capacity() const { return mask + 1; }
+};
+
+#endif // MPSC_QUEUE_H
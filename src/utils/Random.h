@@ -0,0 +1,83 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+// Identificadores de fluxo: cada subsistema deriva seu próprio gerador a
+// partir da seed da partida, sem compartilhar estado com os demais.
+enum RandomStream {
+    STREAM_SPAWN = 1,
+    STREAM_TEXTURES = 2
+};
+
+// Gerador pseudoaleatório xoshiro128** (rápido, 128 bits de estado),
+// inicializado com splitmix64. Substitui o rand() global: cada instância é
+// independente e reproduzível a partir da sua seed.
+class Random {
+private:
+    uint32_t state[4];
+    
+    static uint32_t rotl(uint32_t x, int k) {
+        return (x << k) | (x >> (32 - k));
+    }
+    
+public:
+    explicit Random(uint64_t seed = 0) {
+        setSeed(seed);
+    }
+    
+    // Passo do splitmix64 (usado para espalhar seeds)
+    static uint64_t splitmix64(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+    
+    // Deriva a seed de um fluxo (subsistema, partida, bloco...) a partir de uma seed base
+    static uint64_t deriveSeed(uint64_t seed, uint64_t stream) {
+        uint64_t x = seed ^ (stream * 0xD1B54A32D192ED03ULL);
+        splitmix64(x);
+        return splitmix64(x);
+    }
+    
+    void setSeed(uint64_t seed) {
+        uint64_t x = seed;
+        uint64_t a = splitmix64(x);
+        uint64_t b = splitmix64(x);
+        state[0] = (uint32_t)a;
+        state[1] = (uint32_t)(a >> 32);
+        state[2] = (uint32_t)b;
+        state[3] = (uint32_t)(b >> 32);
+    }
+    
+    // Cria um gerador independente para um fluxo derivado deste
+    Random split(uint64_t stream) {
+        uint64_t base = ((uint64_t)next() << 32) | next();
+        return Random(deriveSeed(base, stream));
+    }
+    
+    uint32_t next() {
+        uint32_t result = rotl(state[1] * 5, 7) * 9;
+        uint32_t t = state[1] << 9;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 11);
+        return result;
+    }
+    
+    // Inteiro em [0, bound)
+    int nextInt(int bound) {
+        return (int)(((uint64_t)next() * (uint32_t)bound) >> 32);
+    }
+    
+    // Float em [0, 1)
+    float nextFloat() {
+        return (next() >> 8) * (1.0f / 16777216.0f);
+    }
+};
+
+#endif // RANDOM_H
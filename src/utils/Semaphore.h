@@ -0,0 +1,53 @@
+#ifndef SEMAPHORE_H
+#define SEMAPHORE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+// Semáforo binário para acordar uma thread consumidora. post() não trava:
+// marca o sinal e só passa pela trava e pela condition variable se o
+// consumidor estiver dormindo (flag sleeping, marcada antes de esperar).
+//
+// sleeping e signaled são seq_cst: ou quem publica vê o consumidor
+// dormindo, ou o consumidor vê o sinal antes de dormir - nunca os dois
+// perdem a escrita do outro.
+class Semaphore {
+private:
+    std::mutex mutex;
+    std::condition_variable available;
+    std::atomic<bool> signaled;
+    std::atomic<bool> sleeping;
+
+public:
+    Semaphore() : signaled(false), sleeping(false) {}
+
+    Semaphore(const Semaphore&) = delete;
+    Semaphore& operator=(const Semaphore&) = delete;
+
+    // Qualquer thread
+    void post() {
+        signaled.store(true);
+        if (sleeping.load()) {
+            // A trava garante que o consumidor já está dentro do wait
+            // (ou ainda vai conferir o sinal) antes do notify
+            { std::lock_guard<std::mutex> lock(mutex); }
+            available.notify_one();
+        }
+    }
+
+    // Apenas a thread consumidora. Bloqueia até haver um post() e o consome;
+    // os posts que se acumularam enquanto ela trabalhava contam como um só
+    void wait() {
+        if (signaled.exchange(false)) return;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        sleeping.store(true);
+        while (!signaled.exchange(false)) {
+            available.wait(lock);
+        }
+        sleeping.store(false);
+    }
+};
+
+#endif // SEMAPHORE_H
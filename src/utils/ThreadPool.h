@@ -0,0 +1,92 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pool fixo de threads com uma fila de tarefas. Usado pelas ferramentas que
+// rodam muitas simulações independentes (cada tarefa tem seu próprio World),
+// então as tarefas não compartilham estado e não precisam de ordem.
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()> > tasks;
+    std::mutex mutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable allDone;
+    int pending;     // Tarefas na fila ou em execução
+    bool stopping;
+
+    void workerLoop() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                taskAvailable.wait(lock, [this] { return stopping || !tasks.empty(); });
+                if (tasks.empty()) return;
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+
+            task();
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pending == 0) {
+                allDone.notify_all();
+            }
+        }
+    }
+
+public:
+    // threadCount <= 0 usa um thread por núcleo
+    explicit ThreadPool(int threadCount = 0) : pending(0), stopping(false) {
+        if (threadCount <= 0) {
+            threadCount = defaultThreadCount();
+        }
+        for (int i = 0; i < threadCount; i++) {
+            workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        taskAvailable.notify_all();
+        for (size_t i = 0; i < workers.size(); i++) {
+            workers[i].join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    static int defaultThreadCount() {
+        int cores = (int)std::thread::hardware_concurrency();
+        return cores > 0 ? cores : 1;
+    }
+
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back(std::move(task));
+            pending++;
+        }
+        taskAvailable.notify_one();
+    }
+
+    // Bloqueia até todas as tarefas enviadas terminarem
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        allDone.wait(lock, [this] { return pending == 0; });
+    }
+
+    int getThreadCount() const { return (int)workers.size(); }
+};
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,106 @@
+#include "Viewport.h"
+#include <cmath>
+
+const float Viewport::VIRTUAL_WIDTH = 800.0f;
+const float Viewport::VIRTUAL_HEIGHT = 600.0f;
+const double Viewport::FIELD_OF_VIEW = 60.0;
+const double Viewport::NEAR_PLANE = 1.0;
+const double Viewport::FAR_PLANE = 1000.0;
+
+int Viewport::pixelWidth = 800;
+int Viewport::pixelHeight = 600;
+GLdouble Viewport::projection3D[16];
+GLdouble Viewport::projection2D[16];
+float Viewport::left = 0.0f;
+float Viewport::right = 800.0f;
+float Viewport::bottom = 0.0f;
+float Viewport::top = 600.0f;
+
+void Viewport::resize(int width, int height) {
+    // Evitar divisão por zero quando a janela é minimizada
+    if (width < 1) width = 1;
+    if (height < 1) height = 1;
+    
+    pixelWidth = width;
+    pixelHeight = height;
+    
+    glViewport(0, 0, width, height);
+    
+    double aspect = (double)width / height;
+    buildPerspective(projection3D, FIELD_OF_VIEW, aspect, NEAR_PLANE, FAR_PLANE);
+    
+    // Ajustar a área virtual mantendo a proporção: o eixo que sobra é estendido
+    double virtualAspect = VIRTUAL_WIDTH / VIRTUAL_HEIGHT;
+    if (aspect >= virtualAspect) {
+        float visibleWidth = (float)(VIRTUAL_HEIGHT * aspect);
+        left = (VIRTUAL_WIDTH - visibleWidth) / 2.0f;
+        right = left + visibleWidth;
+        bottom = 0.0f;
+        top = VIRTUAL_HEIGHT;
+    } else {
+        float visibleHeight = (float)(VIRTUAL_WIDTH / aspect);
+        left = 0.0f;
+        right = VIRTUAL_WIDTH;
+        bottom = (VIRTUAL_HEIGHT - visibleHeight) / 2.0f;
+        top = bottom + visibleHeight;
+    }
+    buildOrtho(projection2D, left, right, bottom, top, -1.0, 1.0);
+    
+    // Deixar a projeção 3D ativa, como o GLUT espera após o reshape
+    apply3D();
+}
+
+void Viewport::apply3D() {
+    glMatrixMode(GL_PROJECTION);
+    glLoadMatrixd(projection3D);
+    glMatrixMode(GL_MODELVIEW);
+}
+
+void Viewport::begin2D() {
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadMatrixd(projection2D);
+    
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+}
+
+void Viewport::end2D() {
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+}
+
+float Viewport::getPixelsPerUnit() {
+    return pixelWidth / (right - left);
+}
+
+float Viewport::pixelsToUnits(float pixels) {
+    return pixels / getPixelsPerUnit();
+}
+
+// Mesma matriz gerada por gluPerspective (ordem coluna-maior)
+void Viewport::buildPerspective(GLdouble* m, double fovY, double aspect, double zNear, double zFar) {
+    double f = 1.0 / std::tan(fovY * M_PI / 360.0);
+    for (int i = 0; i < 16; i++) m[i] = 0.0;
+    m[0] = f / aspect;
+    m[5] = f;
+    m[10] = (zFar + zNear) / (zNear - zFar);
+    m[11] = -1.0;
+    m[14] = (2.0 * zFar * zNear) / (zNear - zFar);
+}
+
+// Mesma matriz gerada por glOrtho (ordem coluna-maior)
+void Viewport::buildOrtho(GLdouble* m, double l, double r, double b, double t, double n, double f) {
+    for (int i = 0; i < 16; i++) m[i] = 0.0;
+    m[0] = 2.0 / (r - l);
+    m[5] = 2.0 / (t - b);
+    m[10] = -2.0 / (f - n);
+    m[12] = -(r + l) / (r - l);
+    m[13] = -(t + b) / (t - b);
+    m[14] = -(f + n) / (f - n);
+    m[15] = 1.0;
+}
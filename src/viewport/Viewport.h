@@ -0,0 +1,63 @@
+#ifndef VIEWPORT_H
+#define VIEWPORT_H
+
+#include <GL/glut.h>
+
+// Serviço de viewport/projeção: as matrizes 3D e 2D são calculadas apenas
+// quando a janela é redimensionada e reaplicadas a partir do cache.
+//
+// Os overlays (HUD e menus) são desenhados em unidades virtuais: a área de
+// layout de 800x600 unidades fica sempre visível e centralizada, e o espaço
+// extra da janela (telas mais largas ou mais altas) estende as bordas.
+class Viewport {
+private:
+    static int pixelWidth;
+    static int pixelHeight;
+    static GLdouble projection3D[16];
+    static GLdouble projection2D[16];
+    
+    // Limites visíveis em unidades virtuais
+    static float left;
+    static float right;
+    static float bottom;
+    static float top;
+    
+    static void buildPerspective(GLdouble* m, double fovY, double aspect, double zNear, double zFar);
+    static void buildOrtho(GLdouble* m, double l, double r, double b, double t, double n, double f);
+    
+public:
+    // Área de layout dos overlays (unidades virtuais)
+    static const float VIRTUAL_WIDTH;
+    static const float VIRTUAL_HEIGHT;
+    
+    // Parâmetros da projeção 3D
+    static const double FIELD_OF_VIEW;
+    static const double NEAR_PLANE;
+    static const double FAR_PLANE;
+    
+    // Recalcula viewport e matrizes (chamar apenas no reshape)
+    static void resize(int width, int height);
+    
+    // Carrega a projeção 3D em cache
+    static void apply3D();
+    
+    // Entra/sai do modo 2D para overlays (salva e restaura as matrizes)
+    static void begin2D();
+    static void end2D();
+    
+    // Limites da tela em unidades virtuais
+    static float getLeft() { return left; }
+    static float getRight() { return right; }
+    static float getBottom() { return bottom; }
+    static float getTop() { return top; }
+    static float getCenterX() { return VIRTUAL_WIDTH / 2.0f; }
+    
+    // Conversão entre pixels reais e unidades virtuais
+    static float getPixelsPerUnit();
+    static float pixelsToUnits(float pixels);
+    
+    static int getPixelWidth() { return pixelWidth; }
+    static int getPixelHeight() { return pixelHeight; }
+};
+
+#endif // VIEWPORT_H
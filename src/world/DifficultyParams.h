@@ -0,0 +1,16 @@
+#ifndef DIFFICULTY_PARAMS_H
+#define DIFFICULTY_PARAMS_H
+
+// Parâmetros que controlam a curva de dificuldade
+struct DifficultyParams {
+    float speedIncreaseInterval; // Segundos entre aumentos de velocidade
+    float speedIncreaseAmount;   // Incremento do multiplicador a cada nível
+    float spawnIntervalBase;     // Intervalo de spawn na velocidade 1x (unidade de espaçamento dos trechos)
+    float spawnIntervalSlope;    // Acréscimo no intervalo por unidade de multiplicador
+    float doubleSpawnChance;     // Chance (0-1) de uma linha ter dois obstáculos
+    int maxObstacles;            // Limite do pool de obstáculos
+    
+    DifficultyParams();
+};
+
+#endif // DIFFICULTY_PARAMS_H
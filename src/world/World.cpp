@@ -0,0 +1,168 @@
+#include "World.h"
+#include "../collision/Collision.h"
+#include "../utils/Hash.h"
+#include <algorithm>
+#include <cstring>
+
+const float World::BASE_FLOOR_SPEED = 20.0f;
+const float World::SPAWN_Z = -50.0f;
+const float World::DESPAWN_Z = 20.0f;
+
+DifficultyParams::DifficultyParams() {
+    speedIncreaseInterval = 20.0f; // A cada 20 segundos
+    speedIncreaseAmount = 0.5f;    // Aumenta 0.5x
+    spawnIntervalBase = 2.0f;
+    spawnIntervalSlope = 0.3f;
+    doubleSpawnChance = 0.3f;
+    maxObstacles = 15;             // Limite reduzido para performance
+}
+
+World::World(uint64_t seed) {
+    reset(seed);
+}
+
+World::World(const DifficultyParams& params, uint64_t seed) : params(params) {
+    reset(seed);
+}
+
+void World::reset(uint64_t newSeed) {
+    seed = newSeed;
+    reset();
+}
+
+void World::reset() {
+    spawnRandom.setSeed(Random::deriveSeed(seed, STREAM_SPAWN));
+
+    player.reset();
+    if (obstacles.getCapacity() != params.maxObstacles) {
+        obstacles.setCapacity(params.maxObstacles);
+    } else {
+        obstacles.clear();
+    }
+    score.startGame();
+    level.reset(params);
+    
+    obstacleSpawnInterval = params.spawnIntervalBase;
+    gameTime = 0.0f;
+    speedMultiplier = 1.0f;
+    floorSpeed = BASE_FLOOR_SPEED;
+    gameOver = false;
+    tickCount = 0;
+}
+
+int World::getSpeedLevel() const {
+    return (int)(gameTime / params.speedIncreaseInterval);
+}
+
+bool World::tick(float deltaTime) {
+    if (gameOver) return false;
+    
+    // Guardar estado anterior para a interpolação da renderização
+    player.storePreviousState();
+    obstacles.storePreviousState();
+    
+    tickCount++;
+    
+    // Atualizar tempo de jogo e velocidade
+    gameTime += deltaTime;
+    speedMultiplier = 1.0f + (getSpeedLevel() * params.speedIncreaseAmount);
+    floorSpeed = BASE_FLOOR_SPEED * speedMultiplier;
+    
+    // Ajustar intervalo de spawn baseado na velocidade (mais rápido = menos obstáculos por segundo)
+    obstacleSpawnInterval = params.spawnIntervalBase + (speedMultiplier - 1.0f) * params.spawnIntervalSlope;
+    
+    // Atualizar jogador e pontuação
+    player.update(deltaTime);
+    score.update(deltaTime);
+    
+    // Spawnar as linhas de obstáculos do trecho atual
+    level.update(deltaTime, obstacleSpawnInterval, getSpeedLevel(), spawnRandom, obstacles, SPAWN_Z);
+    
+    // Atualizar obstáculos (e descartar os que saíram da tela)
+    obstacles.update(deltaTime, floorSpeed * deltaTime, DESPAWN_Z);
+    laneIndex.build(obstacles);
+    
+    // Verificar colisões
+    if (Collision::checkCollisionWithObstacles(player, obstacles, laneIndex)) {
+        gameOver = true;
+        score.gameOver();
+        return true;
+    }
+    return false;
+}
+
+void World::applyInput(InputAction action) {
+    switch (action) {
+        case INPUT_LEFT: moveLeft(); break;
+        case INPUT_RIGHT: moveRight(); break;
+        case INPUT_JUMP: jump(); break;
+        case INPUT_SLIDE: slide(); break;
+        default: break;
+    }
+}
+
+uint32_t World::checksum() const {
+    uint32_t hash = Hash::FNV32_OFFSET;
+    hash = Hash::combine(hash, tickCount);
+    hash = Hash::combine(hash, gameTime);
+    hash = level.hashState(hash);
+    hash = Hash::combine(hash, speedMultiplier);
+    hash = Hash::combine(hash, gameOver);
+    hash = Hash::combine(hash, score.getCurrentScore());
+    hash = player.hashState(hash);
+    hash = obstacles.hashState(hash);
+    return hash;
+}
+
+bool World::saveSnapshot(WorldSnapshot& snapshot) const {
+    // Zerar primeiro: bytes não usados iguais deixam snapshots comparáveis
+    memset((void*)&snapshot, 0, sizeof(WorldSnapshot));
+    snapshot.magic = WorldSnapshot::MAGIC;
+    snapshot.version = WorldSnapshot::VERSION;
+    snapshot.size = sizeof(WorldSnapshot);
+    
+    if (!obstacles.saveState(snapshot.obstacles)) return false;
+    snapshot.params = params;
+    snapshot.seed = seed;
+    snapshot.spawnRandom = spawnRandom;
+    level.saveState(snapshot.level);
+    snapshot.player = player;
+    snapshot.score = score;
+    snapshot.obstacleSpawnInterval = obstacleSpawnInterval;
+    snapshot.gameTime = gameTime;
+    snapshot.speedMultiplier = speedMultiplier;
+    snapshot.floorSpeed = floorSpeed;
+    snapshot.tickCount = tickCount;
+    snapshot.gameOver = gameOver;
+    return true;
+}
+
+bool World::loadSnapshot(const WorldSnapshot& snapshot) {
+    if (!snapshot.isValid() || !snapshot.player.isValidState()) return false;
+    
+    // A biblioteca de trechos vem dos parâmetros (compartilhada, já em cache)
+    DifficultyParams previousParams = params;
+    params = snapshot.params;
+    level.reset(params);
+    if (!level.loadState(snapshot.level) || !obstacles.loadState(snapshot.obstacles)) {
+        // Snapshot inconsistente: voltar a uma partida nova com os parâmetros de antes
+        params = previousParams;
+        reset();
+        return false;
+    }
+    laneIndex.build(obstacles);
+    
+    seed = snapshot.seed;
+    spawnRandom = snapshot.spawnRandom;
+    int highScore = std::max(score.getHighScore(), snapshot.score.getHighScore());
+    player = snapshot.player;
+    score = snapshot.score;
+    score.setHighScore(highScore);
+    obstacleSpawnInterval = snapshot.obstacleSpawnInterval;
+    gameTime = snapshot.gameTime;
+    speedMultiplier = snapshot.speedMultiplier;
+    floorSpeed = snapshot.floorSpeed;
+    tickCount = snapshot.tickCount;
+    gameOver = snapshot.gameOver != 0;
+    return true;
+}
@@ -0,0 +1,102 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "../player/Player.h"
+#include "../obstacle/ObstacleSystem.h"
+#include "../collision/LaneIndex.h"
+#include "../score/Score.h"
+#include "../level/LevelGenerator.h"
+#include "DifficultyParams.h"
+#include "WorldSnapshot.h"
+#include "../utils/Random.h"
+#include <cstdint>
+#include <vector>
+
+// Comandos do jogador que afetam a simulação (gravados nos replays)
+enum InputAction {
+    INPUT_LEFT,
+    INPUT_RIGHT,
+    INPUT_JUMP,
+    INPUT_SLIDE,
+    INPUT_ACTION_COUNT
+};
+
+// Estado completo da simulação do jogo, sem nenhuma dependência de OpenGL.
+// Usado tanto pelo jogo (main.cpp) quanto pelo simulador headless.
+class World {
+private:
+    DifficultyParams params;
+    Player player;
+    ObstacleSystem obstacles;
+    LaneIndex laneIndex;
+    Score score;
+    
+    // Gerador do spawn, derivado da seed da partida
+    uint64_t seed;
+    Random spawnRandom;
+    // Encadeia os trechos de fase verificados
+    LevelGenerator level;
+    
+    float obstacleSpawnInterval;
+    float gameTime;
+    float speedMultiplier;
+    float floorSpeed;
+    bool gameOver;
+    long long tickCount;
+    
+public:
+    // Velocidade do chão na velocidade 1x
+    static const float BASE_FLOOR_SPEED;
+    // Profundidade onde os obstáculos nascem e onde são descartados
+    static const float SPAWN_Z;
+    static const float DESPAWN_Z;
+    
+    World(uint64_t seed = 0);
+    World(const DifficultyParams& params, uint64_t seed = 0);
+    
+    // Inicia uma nova partida com a mesma seed (mantém o recorde)
+    void reset();
+    // Inicia uma nova partida com outra seed
+    void reset(uint64_t newSeed);
+    
+    // Avança um tick de simulação; retorna true se houve colisão neste tick
+    bool tick(float deltaTime);
+    
+    // Comandos do jogador
+    void moveLeft() { player.moveLeft(); }
+    void moveRight() { player.moveRight(); }
+    void jump() { player.jump(); }
+    void slide() { player.slide(); }
+    void applyInput(InputAction action);
+    
+    // Checksum do estado da simulação (detecção de divergência em replays)
+    uint32_t checksum() const;
+    
+    // Copia todo o estado para um snapshot / restaura um snapshot (reinício
+    // instantâneo, pausa em disco, fixtures). save falha se o pool de
+    // obstáculos for maior que o snapshot; load falha com dados inconsistentes.
+    // O recorde atual é mantido se for maior que o do snapshot. Se o load
+    // falhar, o World volta a uma partida nova.
+    bool saveSnapshot(WorldSnapshot& snapshot) const;
+    bool loadSnapshot(const WorldSnapshot& snapshot);
+    
+    // Getters
+    Player& getPlayer() { return player; }
+    const Player& getPlayer() const { return player; }
+    const ObstacleSystem& getObstacles() const { return obstacles; }
+    Score& getScore() { return score; }
+    const Score& getScore() const { return score; }
+    const DifficultyParams& getParams() const { return params; }
+    const LevelGenerator& getLevel() const { return level; }
+    // Troca os parâmetros de dificuldade (vale a partir do próximo reset)
+    void setParams(const DifficultyParams& newParams) { params = newParams; }
+    uint64_t getSeed() const { return seed; }
+    float getGameTime() const { return gameTime; }
+    float getSpeedMultiplier() const { return speedMultiplier; }
+    int getSpeedLevel() const;
+    float getFloorSpeed() const { return floorSpeed; }
+    bool isGameOver() const { return gameOver; }
+    long long getTickCount() const { return tickCount; }
+};
+
+#endif // WORLD_H
@@ -0,0 +1,27 @@
+#include "WorldSnapshot.h"
+#include <fstream>
+#include <iostream>
+
+bool WorldSnapshot::saveToFile(const std::string& filename) const {
+    std::ofstream file(filename.c_str(), std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Erro: não foi possível gravar o estado " << filename << std::endl;
+        return false;
+    }
+    file.write((const char*)this, sizeof(WorldSnapshot));
+    return file.good();
+}
+
+bool WorldSnapshot::loadFromFile(const std::string& filename) {
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Erro: não foi possível abrir o estado " << filename << std::endl;
+        return false;
+    }
+    file.read((char*)this, sizeof(WorldSnapshot));
+    if (!file.good() || !isValid()) {
+        std::cerr << "Erro: " << filename << " não é um estado salvo desta versão" << std::endl;
+        return false;
+    }
+    return true;
+}
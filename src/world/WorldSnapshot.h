@@ -0,0 +1,56 @@
+#ifndef WORLD_SNAPSHOT_H
+#define WORLD_SNAPSHOT_H
+
+#include "DifficultyParams.h"
+#include "../player/Player.h"
+#include "../score/Score.h"
+#include "../obstacle/ObstacleSystem.h"
+#include "../level/LevelGenerator.h"
+#include "../utils/Random.h"
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+// Estado completo de um World em um bloco POD de tamanho fixo: salvar e
+// restaurar são cópias de memória, e o arquivo em disco é o próprio bloco.
+// Só o que não dá para recriar entra aqui - a biblioteca de trechos vem dos
+// parâmetros e o índice por faixa é reconstruído dos obstáculos.
+//
+// Os bytes não usados (obstáculos além de count, preenchimento) ficam
+// zerados, então dois snapshots do mesmo estado são idênticos byte a byte.
+struct WorldSnapshot {
+    static const uint32_t MAGIC = 0x53574443;   // "CDWS"
+    static const uint32_t VERSION = 1;
+    
+    uint32_t magic;
+    uint32_t version;
+    uint32_t size;           // sizeof(WorldSnapshot) de quem gravou
+    
+    DifficultyParams params;
+    uint64_t seed;
+    Random spawnRandom;
+    LevelGenerator::State level;
+    ObstacleSystem::State obstacles;
+    Player player;
+    Score score;
+    
+    float obstacleSpawnInterval;
+    float gameTime;
+    float speedMultiplier;
+    float floorSpeed;
+    int64_t tickCount;
+    uint8_t gameOver;
+    
+    // Cabeçalho confere com esta versão do jogo
+    bool isValid() const {
+        return magic == MAGIC && version == VERSION && size == sizeof(WorldSnapshot);
+    }
+    
+    // Grava/lê o bloco inteiro em um arquivo binário
+    bool saveToFile(const std::string& filename) const;
+    bool loadFromFile(const std::string& filename);
+};
+
+static_assert(std::is_trivially_copyable<WorldSnapshot>::value, "WorldSnapshot precisa ser copiável com memcpy");
+
+#endif // WORLD_SNAPSHOT_H
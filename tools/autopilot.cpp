@@ -0,0 +1,186 @@
+// Partidas automáticas do Cosmic Dash: o piloto automático (src/ai) joga
+// milhares de partidas independentes sem janela, espalhadas por todos os
+// núcleos, e o resultado é a distribuição do tempo de sobrevivência por
+// nível de velocidade - para ver se a curva de dificuldade é vencível.
+//
+// Uso: cosmic_autopilot [--games N] [--threads N] [--seed N] [--max-time S]
+//                       [--interval S] [--amount X]
+//
+// --interval e --amount trocam speedIncreaseInterval e speedIncreaseAmount
+// de DifficultyParams. Cada partida usa uma seed derivada da seed base, então
+// o resultado não depende do número de threads.
+
+#include "ai/Autopilot.h"
+#include "world/World.h"
+#include "utils/ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+struct GameResult {
+    float survivalTime;
+    int speedLevel;      // Nível de velocidade em que a partida terminou
+    int score;
+    bool timedOut;       // Chegou ao tempo máximo sem colidir
+    long long rollouts;
+    long long predictedDecisions;
+    long long droppedObstacles;  // Não couberam no pool de obstáculos
+};
+
+static GameResult playGame(const DifficultyParams& params, uint64_t seed, float maxTime) {
+    const float TICK = 1.0f / 120.0f;
+    World world(params, seed);
+    Autopilot pilot(TICK);
+    
+    GameResult result;
+    result.timedOut = !pilot.play(world, maxTime);
+    result.survivalTime = world.getGameTime();
+    result.speedLevel = world.getSpeedLevel();
+    result.score = world.getScore().getCurrentScore();
+    result.rollouts = pilot.getRollouts();
+    result.predictedDecisions = pilot.getPredictedDecisions();
+    result.droppedObstacles = world.getLevel().getDroppedObstacles();
+    return result;
+}
+
+// Percentil (0-100) de um vetor ordenado
+static float percentile(const std::vector<float>& sorted, float p) {
+    if (sorted.empty()) return 0.0f;
+    size_t index = (size_t)(p / 100.0f * (sorted.size() - 1) + 0.5f);
+    return sorted[index];
+}
+
+int main(int argc, char** argv) {
+    int games = 1000;
+    int threads = 0;
+    uint64_t seed = 1;
+    float maxTime = 600.0f;
+    DifficultyParams params;
+    
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--games") == 0 && i + 1 < argc) {
+            games = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--max-time") == 0 && i + 1 < argc) {
+            maxTime = (float)atof(argv[++i]);
+        } else if (strcmp(argv[i], "--interval") == 0 && i + 1 < argc) {
+            params.speedIncreaseInterval = (float)atof(argv[++i]);
+        } else if (strcmp(argv[i], "--amount") == 0 && i + 1 < argc) {
+            params.speedIncreaseAmount = (float)atof(argv[++i]);
+        } else {
+            std::cerr << "Uso: " << argv[0] << " [--games N] [--threads N] [--seed N] [--max-time S]" << std::endl;
+            std::cerr << "     " << std::string(strlen(argv[0]), ' ') << " [--interval S] [--amount X]" << std::endl;
+            return 1;
+        }
+    }
+    if (games <= 0 || params.speedIncreaseInterval <= 0.0f) {
+        std::cerr << "Parâmetros inválidos." << std::endl;
+        return 1;
+    }
+    
+    std::vector<GameResult> results(games);
+    
+    // Gerar a biblioteca de trechos antes das partidas, fora do tempo medido
+    if (!ChunkLibrary::get(params)->isPlayable()) {
+        return 1;
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    {
+        ThreadPool pool(threads);
+        threads = pool.getThreadCount();
+        for (int g = 0; g < games; g++) {
+            pool.submit([&, g] {
+                results[g] = playGame(params, Random::deriveSeed(seed, g), maxTime);
+            });
+        }
+        pool.wait();
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    // Agregar por nível de velocidade
+    int maxLevel = 0;
+    int timedOut = 0;
+    long long rollouts = 0;
+    long long predictedDecisions = 0;
+    long long droppedObstacles = 0;
+    std::vector<float> survival;
+    for (int g = 0; g < games; g++) {
+        maxLevel = std::max(maxLevel, results[g].speedLevel);
+        survival.push_back(results[g].survivalTime);
+        rollouts += results[g].rollouts;
+        predictedDecisions += results[g].predictedDecisions;
+        droppedObstacles += results[g].droppedObstacles;
+        if (results[g].timedOut) timedOut++;
+    }
+    std::sort(survival.begin(), survival.end());
+    
+    std::vector<int> reached(maxLevel + 1, 0);
+    std::vector<int> died(maxLevel + 1, 0);
+    std::vector<std::vector<float> > deathTimes(maxLevel + 1);
+    for (int g = 0; g < games; g++) {
+        const GameResult& r = results[g];
+        for (int level = 0; level <= r.speedLevel; level++) {
+            reached[level]++;
+        }
+        if (!r.timedOut) {
+            died[r.speedLevel]++;
+            deathTimes[r.speedLevel].push_back(r.survivalTime);
+        }
+    }
+    
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "=== COSMIC DASH AUTOPILOT ===" << std::endl;
+    std::cout << "Seed: " << seed << "  Partidas: " << games << "  Threads: " << threads << std::endl;
+    std::cout << "Dificuldade: +" << params.speedIncreaseAmount << "x a cada "
+              << params.speedIncreaseInterval << "s (tempo máximo " << maxTime << "s)" << std::endl;
+    std::cout << "Tempo real: " << elapsed << "s (" << games / elapsed << " partidas/s, "
+              << rollouts << " simulações de busca, " << predictedDecisions
+              << " decisões resolvidas pela previsão)" << std::endl;
+    std::cout << std::endl;
+    
+    double sum = 0.0;
+    for (size_t i = 0; i < survival.size(); i++) sum += survival[i];
+    std::cout << "Sobrevivência (s): média " << sum / games
+              << "  p10 " << percentile(survival, 10.0f)
+              << "  p50 " << percentile(survival, 50.0f)
+              << "  p90 " << percentile(survival, 90.0f)
+              << "  máx " << survival.back() << std::endl;
+    if (timedOut > 0) {
+        std::cout << timedOut << " partida(s) chegaram ao tempo máximo sem colidir" << std::endl;
+    }
+    if (droppedObstacles > 0) {
+        std::cout << "Aviso: " << droppedObstacles << " obstáculos descartados com o pool cheio (maxObstacles = "
+                  << params.maxObstacles << ")" << std::endl;
+    }
+    std::cout << std::endl;
+    
+    std::cout << "Nível  Velocidade  Chegaram  Morreram  Taxa de morte  Morte p50 (s)" << std::endl;
+    for (int level = 0; level <= maxLevel; level++) {
+        std::vector<float>& times = deathTimes[level];
+        std::sort(times.begin(), times.end());
+        float rate = reached[level] > 0 ? 100.0f * died[level] / reached[level] : 0.0f;
+        std::cout << std::setw(5) << level
+                  << std::setw(11) << 1.0f + level * params.speedIncreaseAmount << "x"
+                  << std::setw(10) << reached[level]
+                  << std::setw(10) << died[level]
+                  << std::setw(14) << rate << "%"
+                  << std::setw(15);
+        if (times.empty()) {
+            std::cout << "-";
+        } else {
+            std::cout << percentile(times, 50.0f);
+        }
+        std::cout << std::endl;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,239 @@
+// Simulador headless do Cosmic Dash: executa o loop de jogo sem janela
+// (apenas libcosmic_sim, sem OpenGL) e mede quantos ticks por segundo
+// a simulação consegue processar.
+//
+// Uso: cosmic_headless [--ticks N] [--seed N] [--record arquivo]
+//                      [--load-state arquivo] [--save-state arquivo] [--rewind]
+//      cosmic_headless --replay arquivo [--repeat N]
+//
+// Com --record, a primeira partida simulada é gravada. Com --replay, a
+// partida gravada é reproduzida tick a tick (N vezes), verificando os
+// checksums - o mesmo traço de jogo pode ser medido em qualquer build.
+//
+// --load-state começa a primeira partida de um estado salvo (fixture) e
+// --save-state grava o estado ao fim dos ticks; o checksum final identifica
+// o estado em que a simulação terminou.
+//
+// --rewind grava cada tick no RewindBuffer e, a cada colisão, volta a vários
+// ticks da janela conferindo o checksum, medindo o custo do seek.
+
+#include "world/World.h"
+#include "replay/Replay.h"
+#include "replay/RewindBuffer.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Reproduz um replay e verifica cada tick; retorna o código de saída
+static int runReplay(const std::string& filename, int repeat) {
+    ReplayPlayer replay;
+    if (!replay.load(filename)) {
+        return 1;
+    }
+    
+    World world;
+    long long ticks = 0;
+    bool diverged = false;
+    
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeat; r++) {
+        if (!replay.start(world)) {
+            std::cerr << "Erro: o snapshot inicial do replay não pôde ser restaurado" << std::endl;
+            return 1;
+        }
+        while (!replay.isFinished(world)) {
+            replay.applyInputs(world);
+            world.tick(replay.getStepSize());
+            ticks++;
+            if (!replay.verifyTick(world)) {
+                diverged = true;
+                break;
+            }
+        }
+        if (diverged) break;
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "=== COSMIC DASH REPLAY ===" << std::endl;
+    std::cout << "Arquivo: " << filename << " (seed " << replay.getData().seed << ", "
+              << replay.getTotalTicks() << " ticks, " << replay.getData().events.size() << " entradas)" << std::endl;
+    std::cout << "Ticks reproduzidos: " << ticks << " em " << elapsed << "s ("
+              << (elapsed > 0.0 ? ticks / elapsed : 0.0) << " ticks/s)" << std::endl;
+    
+    if (diverged) {
+        std::cout << "DIVERGÊNCIA no tick " << replay.getDivergenceTick() << std::endl;
+        return 2;
+    }
+    std::cout << "Replay idêntico: todos os checksums conferem." << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    long long totalTicks = 10000000;
+    uint64_t seed = 1;
+    std::string recordFile;
+    std::string replayFile;
+    std::string loadStateFile;
+    std::string saveStateFile;
+    bool rewind = false;
+    int repeat = 1;
+    
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            totalTicks = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordFile = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayFile = argv[++i];
+        } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--load-state") == 0 && i + 1 < argc) {
+            loadStateFile = argv[++i];
+        } else if (strcmp(argv[i], "--save-state") == 0 && i + 1 < argc) {
+            saveStateFile = argv[++i];
+        } else if (strcmp(argv[i], "--rewind") == 0) {
+            rewind = true;
+        } else {
+            std::cerr << "Uso: " << argv[0] << " [--ticks N] [--seed N] [--record arquivo]"
+                      << " [--load-state arquivo] [--save-state arquivo] [--rewind]" << std::endl;
+            std::cerr << "     " << argv[0] << " --replay arquivo [--repeat N]" << std::endl;
+            return 1;
+        }
+    }
+    
+    if (!replayFile.empty()) {
+        return runReplay(replayFile, repeat);
+    }
+    
+    const float TICK = 1.0f / 120.0f;
+    
+    // Cada partida usa uma seed derivada da seed base; as entradas usam outro fluxo
+    long long runs = 0;
+    World world(Random::deriveSeed(seed, runs));
+    Random inputRandom(Random::deriveSeed(seed, 0xC0FFEE));
+    
+    // A primeira partida continua do estado salvo
+    if (!loadStateFile.empty()) {
+        WorldSnapshot snapshot;
+        if (!snapshot.loadFromFile(loadStateFile) || !world.loadSnapshot(snapshot)) {
+            return 1;
+        }
+    }
+    
+    // Com --load-state o replay leva o estado carregado como ponto de partida
+    ReplayRecorder recorder;
+    if (!recordFile.empty() && !recorder.begin(world, 120)) {
+        return 1;
+    }
+    
+    double survivalSum = 0.0;
+    
+    // Rewind: checksums da janela (por tick) para conferir cada seek
+    RewindBuffer rewindBuffer;
+    std::vector<uint32_t> rewindChecksums(RewindBuffer::DEFAULT_WINDOW_TICKS * 2);
+    World rewindProbe;
+    long long seeks = 0;
+    long long seekFailures = 0;
+    double seekTime = 0.0;
+    double worstSeek = 0.0;
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    for (long long t = 0; t < totalTicks; t++) {
+        // Entradas aleatórias esparsas para exercitar movimento, pulo e deslize
+        int action = inputRandom.nextInt(64);
+        if (action < INPUT_ACTION_COUNT) {
+            world.applyInput((InputAction)action);
+            recorder.recordInput(world, (InputAction)action);
+        }
+        
+        bool collided = world.tick(TICK);
+        recorder.recordTick(world);
+        
+        if (rewind) {
+            rewindBuffer.record(world);
+            rewindChecksums[world.getTickCount() % rewindChecksums.size()] = world.checksum();
+        }
+        
+        if (collided && rewind) {
+            // Voltar ao início, ao meio e a alguns ticks antes da colisão
+            long long oldest = rewindBuffer.getOldestTick();
+            long long newest = rewindBuffer.getNewestTick();
+            long long targets[4] = { oldest, (oldest + newest) / 2, newest - 30, newest };
+            for (int k = 0; k < 4; k++) {
+                long long target = targets[k] < oldest ? oldest : targets[k];
+                auto seekStart = std::chrono::steady_clock::now();
+                bool ok = rewindBuffer.seek(rewindProbe, target);
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - seekStart).count();
+                seeks++;
+                seekTime += seconds;
+                if (seconds > worstSeek) worstSeek = seconds;
+                if (!ok || rewindProbe.checksum() != rewindChecksums[target % rewindChecksums.size()]) {
+                    seekFailures++;
+                }
+            }
+        }
+        
+        if (collided) {
+            // Colisão: registrar a partida e começar outra
+            if (recorder.isRecording()) {
+                recorder.stop();
+                if (recorder.save(recordFile)) {
+                    std::cout << "Replay da primeira partida salvo em " << recordFile << std::endl;
+                }
+            }
+            runs++;
+            survivalSum += world.getGameTime();
+            world.reset(Random::deriveSeed(seed, runs));
+        }
+    }
+    
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    if (!saveStateFile.empty()) {
+        WorldSnapshot snapshot;
+        if (!world.saveSnapshot(snapshot) || !snapshot.saveToFile(saveStateFile)) {
+            return 1;
+        }
+    }
+    
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "=== COSMIC DASH HEADLESS ===" << std::endl;
+    std::cout << "Seed: " << seed << std::endl;
+    std::cout << "Ticks simulados: " << totalTicks << " (" << totalTicks * TICK << "s de jogo)" << std::endl;
+    std::cout << "Tempo real: " << elapsed << "s" << std::endl;
+    std::cout << "Ticks/s: " << (elapsed > 0.0 ? totalTicks / elapsed : 0.0) << std::endl;
+    const ChunkLibrary& library = world.getLevel().getLibrary();
+    std::cout << "Trechos verificados:";
+    for (int tier = 0; tier < ChunkLibrary::TIER_COUNT; tier++) {
+        std::cout << " " << library.getChunks(tier).size();
+    }
+    std::cout << " (" << library.getCandidates() << " sorteados, " << library.getRejectedUnsolvable()
+              << " insolúveis e " << library.getRejectedTrivial() << " triviais descartados)" << std::endl;
+    if (world.getLevel().getDroppedObstacles() > 0) {
+        std::cout << "Aviso: " << world.getLevel().getDroppedObstacles()
+                  << " obstáculos descartados com o pool cheio (maxObstacles = "
+                  << world.getParams().maxObstacles << ")" << std::endl;
+    }
+    std::cout << "Partidas concluídas: " << runs << std::endl;
+    if (runs > 0) {
+        std::cout << "Sobrevivência média: " << survivalSum / runs << "s" << std::endl;
+    }
+    if (rewind && seeks > 0) {
+        std::cout << "Rewind: " << seeks << " seeks (" << seekFailures << " divergentes), médio "
+                  << seekTime / seeks * 1e6 << "us, pior " << worstSeek * 1e6 << "us; memória reservada "
+                  << rewindBuffer.getReservedBytes() / 1024 << " KB" << std::endl;
+    }
+    std::cout << "Checksum final: " << std::hex << world.checksum() << std::dec
+              << " (tick " << world.getTickCount() << " da partida)" << std::endl;
+    
+    return 0;
+}
@@ -0,0 +1,206 @@
+// Benchmark dos kernels das texturas procedurais (TextureKernel).
+//
+// Uso: texture_bench [--repeat N]
+//
+// Gera a galáxia e a nebulosa em 512x512 e 4096x4096 com o caminho original
+// (std::atan2/std::sin/std::cos, um pixel por vez) e com cada backend
+// suportado pela CPU, numa thread só. Confere que todos os backends produzem
+// a mesma imagem bit a bit e mostra a maior diferença de pixel em relação ao
+// caminho original, além do erro máximo de cada aproximação.
+
+#include "texture/TextureGenerator.h"
+#include "texture/TextureKernel.h"
+#include "utils/Random.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+
+static const int SIZES[] = {512, 4096};
+static const KernelBackend BACKENDS[] = {KERNEL_SCALAR, KERNEL_SSE2, KERNEL_AVX2};
+static const ProceduralTexture KINDS[] = {PROCEDURAL_GALAXY, PROCEDURAL_NEBULA};
+static const uint64_t SEED = 12345;
+static const double TWO_PI = 6.283185307179586;
+
+// Galáxia original (libm), com o mesmo ruído por faixa do gerador
+static void referenceGalaxy(TextureImage& image) {
+    int width = image.width;
+    int height = image.height;
+    float centerX = width / 2.0f;
+    float centerY = height / 2.0f;
+    float maxRadius = std::min(centerX, centerY);
+
+    for (int tile = 0; tile < TextureGenerator::tileCount(height); tile++) {
+        Random random(Random::deriveSeed(SEED, (uint64_t)tile));
+        int lastRow = std::min((tile + 1) * TextureGenerator::TILE_ROWS, height);
+        for (int y = tile * TextureGenerator::TILE_ROWS; y < lastRow; y++) {
+            for (int x = 0; x < width; x++) {
+                unsigned char* pixel = &image.pixels[((size_t)y * width + x) * 3];
+                float dx = x - centerX;
+                float dy = y - centerY;
+                float distance = sqrt(dx * dx + dy * dy);
+                float normalizedDistance = distance / maxRadius;
+                float angle = atan2(dy, dx);
+                float spiral = sin(angle * 3.0f + distance * 0.1f) * 0.5f + 0.5f;
+
+                float intensity = std::max(0.0f, std::min(1.0f, 1.0f - normalizedDistance));
+                intensity += random.nextInt(100) / 100.0f * 0.3f;
+                intensity = std::max(0.0f, std::min(1.0f, intensity));
+                intensity *= spiral * 0.7f + 0.3f;
+
+                if (normalizedDistance < 0.3f) {
+                    pixel[0] = (unsigned char)(255 * intensity);
+                    pixel[1] = (unsigned char)(240 * intensity);
+                    pixel[2] = (unsigned char)(200 * intensity);
+                } else if (normalizedDistance < 0.7f) {
+                    pixel[0] = (unsigned char)(100 * intensity);
+                    pixel[1] = (unsigned char)(150 * intensity);
+                    pixel[2] = (unsigned char)(255 * intensity);
+                } else {
+                    pixel[0] = (unsigned char)(80 * intensity);
+                    pixel[1] = (unsigned char)(50 * intensity);
+                    pixel[2] = (unsigned char)(120 * intensity);
+                }
+            }
+        }
+    }
+}
+
+// Nebulosa original (libm)
+static void referenceNebula(TextureImage& image) {
+    int width = image.width;
+    int height = image.height;
+
+    for (int tile = 0; tile < TextureGenerator::tileCount(height); tile++) {
+        Random random(Random::deriveSeed(SEED, (uint64_t)tile));
+        int lastRow = std::min((tile + 1) * TextureGenerator::TILE_ROWS, height);
+        for (int y = tile * TextureGenerator::TILE_ROWS; y < lastRow; y++) {
+            for (int x = 0; x < width; x++) {
+                unsigned char* pixel = &image.pixels[((size_t)y * width + x) * 3];
+                float nx = (float)x / width * 4.0f;
+                float ny = (float)y / height * 4.0f;
+                float noise1 = sin(nx * 3.14159f) * cos(ny * 3.14159f);
+                float noise2 = sin(nx * 6.28318f) * cos(ny * 6.28318f) * 0.5f;
+                float noise3 = random.nextInt(100) / 500.0f;
+
+                float intensity = (noise1 + noise2 + noise3) * 0.5f + 0.5f;
+                intensity = std::max(0.0f, std::min(1.0f, intensity));
+                pixel[0] = (unsigned char)(120 * intensity + 30);
+                pixel[1] = (unsigned char)(80 * intensity + 20);
+                pixel[2] = (unsigned char)(160 * intensity + 40);
+            }
+        }
+    }
+}
+
+// Erros máximos das aproximações nos argumentos que as texturas usam
+static void printApproxErrors() {
+    double sinError = 0.0;
+    double cosError = 0.0;
+    for (float x = -320.0f; x < 320.0f; x += 0.001f) {
+        sinError = std::max(sinError, std::fabs((double)TextureKernel::sinApprox(x) - std::sin((double)x)));
+    }
+    for (float x = 0.0f; x < 26.0f; x += 0.0001f) {
+        cosError = std::max(cosError, std::fabs((double)TextureKernel::cosApprox(x) - std::cos((double)x)));
+    }
+
+    double atanError = 0.0;
+    for (float y = -2048.0f; y <= 2048.0f; y += 3.5f) {
+        for (float x = -2048.0f; x <= 2048.0f; x += 3.5f) {
+            double error = std::fabs((double)TextureKernel::atan2Approx(y, x) - std::atan2((double)y, (double)x));
+            // O corte em ±pi não é erro
+            atanError = std::max(atanError, std::min(error, std::fabs(error - TWO_PI)));
+        }
+    }
+
+    std::cout << std::scientific << std::setprecision(2)
+              << "Erro máximo: sin " << sinError << " (|x| < 320), cos " << cosError
+              << " (0 a 26), atan2 " << atanError << " rad" << std::endl;
+    std::cout << std::fixed;
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    int repeat = 3; // medições por caso (vale a mais rápida)
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = std::max(1, std::atoi(argv[++i]));
+        }
+    }
+
+    std::cout << "=== COSMIC DASH - KERNELS DE TEXTURA ===" << std::endl;
+    printApproxErrors();
+
+    bool identical = true;
+    for (int size : SIZES) {
+        for (ProceduralTexture kind : KINDS) {
+            double pixels = (double)size * size;
+            std::cout << std::endl << TextureGenerator::getName(kind) << " " << size << "x" << size << ":" << std::endl;
+
+            TextureImage reference;
+            TextureGenerator::allocate(reference, size, size);
+            double referenceTime = 1e30;
+            for (int r = 0; r < repeat; r++) {
+                auto start = std::chrono::steady_clock::now();
+                if (kind == PROCEDURAL_GALAXY) referenceGalaxy(reference);
+                else referenceNebula(reference);
+                referenceTime = std::min(referenceTime, secondsSince(start));
+            }
+            std::cout << "  " << std::setw(8) << "libm" << ": " << std::setprecision(1) << std::setw(8)
+                      << referenceTime * 1000.0 << " ms  " << std::setw(7) << pixels / referenceTime / 1e6
+                      << " Mpixels/s" << std::endl;
+
+            TextureImage scalar;
+            for (KernelBackend backend : BACKENDS) {
+                if (!ObstacleKernel::isSupported(backend)) {
+                    std::cout << "  " << std::setw(8) << ObstacleKernel::getBackendName(backend)
+                              << ": não suportado nesta CPU" << std::endl;
+                    continue;
+                }
+                TextureKernel::setBackend(backend);
+
+                TextureImage image;
+                TextureGenerator::allocate(image, size, size);
+                double elapsed = 1e30;
+                for (int r = 0; r < repeat; r++) {
+                    auto start = std::chrono::steady_clock::now();
+                    TextureGenerator::generate(kind, SEED, image);
+                    elapsed = std::min(elapsed, secondsSince(start));
+                }
+
+                if (backend == KERNEL_SCALAR) {
+                    scalar = image;
+                } else if (image.pixels != scalar.pixels) {
+                    identical = false;
+                }
+
+                // Diferença em relação ao caminho original
+                int maxDiff = 0;
+                long long differing = 0;
+                for (size_t i = 0; i < image.pixels.size(); i++) {
+                    int diff = std::abs((int)image.pixels[i] - (int)reference.pixels[i]);
+                    if (diff > 0) differing++;
+                    maxDiff = std::max(maxDiff, diff);
+                }
+
+                std::cout << "  " << std::setw(8) << ObstacleKernel::getBackendName(backend) << ": "
+                          << std::setprecision(1) << std::setw(8) << elapsed * 1000.0 << " ms  "
+                          << std::setw(7) << pixels / elapsed / 1e6 << " Mpixels/s  "
+                          << std::setprecision(2) << referenceTime / elapsed << "x  (dif. máx "
+                          << maxDiff << ", " << std::setprecision(3)
+                          << 100.0 * differing / image.pixels.size() << "% dos canais)" << std::endl;
+            }
+        }
+    }
+
+    std::cout << std::endl << (identical ? "Todos os backends produzem imagens idênticas."
+                                         : "ERRO: backends divergem do escalar!") << std::endl;
+    return identical ? 0 : 2;
+}
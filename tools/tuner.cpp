@@ -0,0 +1,285 @@
+// Ajuste dos parâmetros de dificuldade: varre uma grade (ou uma amostra
+// aleatória) de valores de DifficultyParams, joga várias partidas com o
+// piloto automático em cada ponto, em paralelo e sem renderização, e grava
+// um CSV com a média e os percentis do tempo de sobrevivência.
+//
+// Uso: cosmic_tuner [--interval F] [--amount F] [--spawn-base F]
+//                   [--spawn-slope F] [--double F] [--samples N]
+//                   [--games N] [--max-time S] [--threads N] [--seed N]
+//                   [--out arquivo.csv]
+//
+// Cada parâmetro aceita um valor fixo ("20"), uma grade ("10:30:5" =
+// mínimo:máximo:passo) ou, com --samples N, um intervalo ("10:30") sorteado
+// uniformemente em N pontos. Parâmetros omitidos ficam no valor padrão.
+
+#include "ai/Autopilot.h"
+#include "world/World.h"
+#include "utils/ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Parâmetros varridos
+enum TunedParam {
+    PARAM_INTERVAL,
+    PARAM_AMOUNT,
+    PARAM_SPAWN_BASE,
+    PARAM_SPAWN_SLOPE,
+    PARAM_DOUBLE_CHANCE,
+    PARAM_COUNT
+};
+
+static const char* PARAM_OPTIONS[PARAM_COUNT] = {
+    "--interval", "--amount", "--spawn-base", "--spawn-slope", "--double"
+};
+
+static const char* PARAM_COLUMNS[PARAM_COUNT] = {
+    "speed_increase_interval", "speed_increase_amount", "spawn_interval_base",
+    "spawn_interval_slope", "double_spawn_chance"
+};
+
+struct ParamRange {
+    float min;
+    float max;
+    float step;          // 0 = valor fixo (ou sorteado, com --samples)
+    bool interval;       // Veio como "min:max" (só vale com --samples)
+    
+    int gridCount() const {
+        if (step <= 0.0f || max <= min) return 1;
+        return (int)((max - min) / step + 1e-4f) + 1;
+    }
+};
+
+static float* paramField(DifficultyParams& params, int param) {
+    switch (param) {
+        case PARAM_INTERVAL: return &params.speedIncreaseInterval;
+        case PARAM_AMOUNT: return &params.speedIncreaseAmount;
+        case PARAM_SPAWN_BASE: return &params.spawnIntervalBase;
+        case PARAM_SPAWN_SLOPE: return &params.spawnIntervalSlope;
+        default: return &params.doubleSpawnChance;
+    }
+}
+
+// "v", "min:max" ou "min:max:passo"
+static bool parseRange(const char* text, ParamRange& range) {
+    float values[3];
+    int count = 0;
+    const char* p = text;
+    while (count < 3) {
+        char* end;
+        values[count++] = strtof(p, &end);
+        if (end == p) return false;
+        if (*end == '\0') break;
+        if (*end != ':') return false;
+        p = end + 1;
+    }
+    range.min = values[0];
+    range.max = count > 1 ? values[1] : values[0];
+    range.step = count > 2 ? values[2] : 0.0f;
+    range.interval = count == 2;
+    if (count > 2 && range.step <= 0.0f) return false;
+    return range.max >= range.min;
+}
+
+// Percentil (0-100) de um vetor ordenado
+static float percentile(const std::vector<float>& sorted, float p) {
+    if (sorted.empty()) return 0.0f;
+    size_t index = (size_t)(p / 100.0f * (sorted.size() - 1) + 0.5f);
+    return sorted[index];
+}
+
+int main(int argc, char** argv) {
+    DifficultyParams defaults;
+    ParamRange ranges[PARAM_COUNT];
+    for (int p = 0; p < PARAM_COUNT; p++) {
+        float value = *paramField(defaults, p);
+        ranges[p].min = ranges[p].max = value;
+        ranges[p].step = 0.0f;
+        ranges[p].interval = false;
+    }
+    
+    int samples = 0;
+    int games = 64;
+    int threads = 0;
+    float maxTime = 300.0f;
+    uint64_t seed = 1;
+    std::string outFile = "tuning.csv";
+    
+    for (int i = 1; i < argc; i++) {
+        int param = -1;
+        for (int p = 0; p < PARAM_COUNT; p++) {
+            if (strcmp(argv[i], PARAM_OPTIONS[p]) == 0) param = p;
+        }
+        if (param >= 0 && i + 1 < argc) {
+            if (!parseRange(argv[++i], ranges[param])) {
+                std::cerr << "Valor inválido para " << PARAM_OPTIONS[param] << ": " << argv[i] << std::endl;
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc) {
+            samples = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--games") == 0 && i + 1 < argc) {
+            games = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--max-time") == 0 && i + 1 < argc) {
+            maxTime = (float)atof(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            outFile = argv[++i];
+        } else {
+            std::cerr << "Uso: " << argv[0] << " [--interval F] [--amount F] [--spawn-base F] [--spawn-slope F] [--double F]" << std::endl;
+            std::cerr << "     [--samples N] [--games N] [--max-time S] [--threads N] [--seed N] [--out arquivo.csv]" << std::endl;
+            std::cerr << "Cada parâmetro: valor, mínimo:máximo:passo (grade) ou mínimo:máximo (com --samples)" << std::endl;
+            return 1;
+        }
+    }
+    if (games <= 0) {
+        std::cerr << "Parâmetros inválidos." << std::endl;
+        return 1;
+    }
+    // Sem --samples um intervalo "min:max" não teria passo: varreria só o mínimo
+    if (samples <= 0) {
+        for (int p = 0; p < PARAM_COUNT; p++) {
+            if (ranges[p].interval) {
+                std::cerr << PARAM_OPTIONS[p] << " " << ranges[p].min << ":" << ranges[p].max
+                          << " precisa de --samples N (ou de um passo: mínimo:máximo:passo)" << std::endl;
+                return 1;
+            }
+        }
+    }
+    
+    // Montar os pontos: grade completa ou amostra aleatória
+    std::vector<DifficultyParams> points;
+    if (samples > 0) {
+        Random sampleRandom(Random::deriveSeed(seed, 0x54554E45));
+        for (int s = 0; s < samples; s++) {
+            DifficultyParams params = defaults;
+            for (int p = 0; p < PARAM_COUNT; p++) {
+                *paramField(params, p) = ranges[p].min + (ranges[p].max - ranges[p].min) * sampleRandom.nextFloat();
+            }
+            points.push_back(params);
+        }
+    } else {
+        int total = 1;
+        for (int p = 0; p < PARAM_COUNT; p++) total *= ranges[p].gridCount();
+        for (int n = 0; n < total; n++) {
+            DifficultyParams params = defaults;
+            int rest = n;
+            for (int p = 0; p < PARAM_COUNT; p++) {
+                int count = ranges[p].gridCount();
+                *paramField(params, p) = ranges[p].min + (rest % count) * ranges[p].step;
+                rest /= count;
+            }
+            points.push_back(params);
+        }
+    }
+    for (size_t n = 0; n < points.size(); n++) {
+        if (points[n].speedIncreaseInterval <= 0.0f || points[n].spawnIntervalBase <= 0.0f) {
+            std::cerr << "Parâmetros inválidos: intervalos precisam ser positivos." << std::endl;
+            return 1;
+        }
+    }
+    
+    int pointCount = (int)points.size();
+    std::cout << "=== COSMIC DASH TUNER ===" << std::endl;
+    std::cout << pointCount << " ponto(s) x " << games << " partidas (tempo máximo " << maxTime << "s)" << std::endl;
+    
+    // Uma tarefa por partida: os pontos longos não seguram uma thread sozinhos.
+    // A seed da partida só depende do índice dela, então pontos diferentes
+    // enfrentam as mesmas seeds e o resultado não depende das threads.
+    std::vector<float> survival((size_t)pointCount * games);
+    std::vector<unsigned char> timedOut((size_t)pointCount * games);
+    std::vector<long long> dropped((size_t)pointCount * games);
+    
+    auto start = std::chrono::steady_clock::now();
+    {
+        ThreadPool pool(threads);
+        threads = pool.getThreadCount();
+        
+        // Primeiro as bibliotecas de trechos de cada ponto, em paralelo, para
+        // que nenhuma partida espere pela geração
+        for (int n = 0; n < pointCount; n++) {
+            pool.submit([&, n] {
+                ChunkLibrary::get(points[n]);
+            });
+        }
+        pool.wait();
+        
+        // Sem trechos a fase não tem obstáculos e a sobrevivência seria infinita
+        for (int n = 0; n < pointCount; n++) {
+            if (!ChunkLibrary::get(points[n])->isPlayable()) {
+                std::cerr << "Ponto " << n << " sem trechos vencíveis; ajuste os intervalos varridos." << std::endl;
+                return 1;
+            }
+        }
+        
+        for (int n = 0; n < pointCount; n++) {
+            for (int g = 0; g < games; g++) {
+                pool.submit([&, n, g] {
+                    World world(points[n], Random::deriveSeed(seed, g));
+                    Autopilot pilot;
+                    size_t slot = (size_t)n * games + g;
+                    timedOut[slot] = !pilot.play(world, maxTime);
+                    survival[slot] = world.getGameTime();
+                    dropped[slot] = world.getLevel().getDroppedObstacles();
+                });
+            }
+        }
+        pool.wait();
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    std::ofstream out(outFile.c_str());
+    if (!out) {
+        std::cerr << "Não foi possível criar " << outFile << std::endl;
+        return 1;
+    }
+    for (int p = 0; p < PARAM_COUNT; p++) out << PARAM_COLUMNS[p] << ",";
+    out << "games,timeouts,mean,p10,p25,p50,p75,p90,max" << std::endl;
+    
+    for (int n = 0; n < pointCount; n++) {
+        std::vector<float> times(survival.begin() + (size_t)n * games, survival.begin() + (size_t)(n + 1) * games);
+        std::sort(times.begin(), times.end());
+        double sum = 0.0;
+        int timeouts = 0;
+        for (int g = 0; g < games; g++) {
+            sum += times[g];
+            timeouts += timedOut[(size_t)n * games + g];
+        }
+        
+        DifficultyParams& params = points[n];
+        out << std::setprecision(6);
+        for (int p = 0; p < PARAM_COUNT; p++) out << *paramField(params, p) << ",";
+        out << std::fixed << std::setprecision(3)
+            << games << "," << timeouts << "," << sum / games << ","
+            << percentile(times, 10.0f) << "," << percentile(times, 25.0f) << ","
+            << percentile(times, 50.0f) << "," << percentile(times, 75.0f) << ","
+            << percentile(times, 90.0f) << "," << times.back() << std::endl;
+        out.unsetf(std::ios::floatfield);
+    }
+    
+    int droppedPoints = 0;
+    for (int n = 0; n < pointCount; n++) {
+        long long total = 0;
+        for (int g = 0; g < games; g++) total += dropped[(size_t)n * games + g];
+        if (total > 0) droppedPoints++;
+    }
+    if (droppedPoints > 0) {
+        std::cout << "Aviso: " << droppedPoints << " ponto(s) descartaram obstáculos com o pool cheio (maxObstacles = "
+                  << defaults.maxObstacles << ")" << std::endl;
+    }
+    
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Tempo real: " << elapsed << "s com " << threads << " thread(s) ("
+              << pointCount * games / elapsed << " partidas/s)" << std::endl;
+    std::cout << "Resultados salvos em " << outFile << std::endl;
+    return 0;
+}